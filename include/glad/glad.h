@@ -707,6 +707,15 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Like gladLoadGLLoader, but each function pointer is resolved through the
+ * loader on its first call. The loader must stay valid, and the same context
+ * current, for as long as GL is used.
+ * Every pointer of a supported version or extension is non-NULL, so
+ * if(glad_glFoo) no longer detects a symbol the loader lacks; check the
+ * GLAD_GL_* flags instead. Calling such a function does nothing and
+ * returns 0. */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -0,0 +1,51 @@
+/*
+
+    Null GL backend for glad.
+
+    gladMockGetProcAddress can be passed to gladLoadGLLoader (or
+    gladLoadGLLoaderLazy) in place of the platform loader. Every entry point
+    then resolves to a stub that records the call and does no rendering, so
+    the client can run its frame loop without a GPU or a GL context and be
+    profiled for CPU-side cost.
+
+    The mock reports a 3.3 core context with the extensions given to
+    gladMockSetExtensions, hands out increasing object names, reports
+    shaders and programs as compiled and linked, and accounts the bytes
+    passed to buffer and texture uploads.
+
+*/
+
+#ifndef __glad_mock_h_
+#define __glad_mock_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct gladMockStats {
+    unsigned long calls;            /* every call into the mock */
+    unsigned long draw_calls;       /* glDraw* except glDrawBuffer*, glMultiDraw* */
+    unsigned long objects_created;  /* names handed out by glGen*, glCreate* */
+    GLuint64 buffer_alloc_bytes;    /* sizes passed to glBufferData / glBufferStorage */
+    GLuint64 buffer_upload_bytes;   /* bytes of data passed to buffers */
+    GLuint64 texture_upload_bytes;  /* bytes of pixels passed to glTex(Sub)Image* */
+};
+
+GLAPI void* gladMockGetProcAddress(const char *name);
+
+/* Extensions reported by the mock context. The strings are borrowed and must
+ * outlive the next load. Pass NULL / 0 to report none (the default); the
+ * loader then sees GL_NUM_EXTENSIONS as 0 and loads the core functions only. */
+GLAPI void gladMockSetExtensions(const char *const *names, int count);
+
+GLAPI void gladMockReset(void);
+GLAPI void gladMockGetStats(struct gladMockStats *stats);
+GLAPI unsigned long gladMockGetCallCount(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
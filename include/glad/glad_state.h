@@ -0,0 +1,54 @@
+/*
+
+    GL state caching for glad.
+
+    gladStateCacheInstall wraps the bind and uniform entry points a renderer
+    calls every frame (program, vertex array, buffer and texture bindings,
+    glUniform* values) and drops calls that would not change anything. Call
+    it after gladLoadGLLoader.
+
+    Extension and direct state access entry points that change the same
+    state (glUseProgramObjectARB, glBindBufferARB, glVertexArrayElementBuffer,
+    glBindMultiTextureEXT, glProgramUniform*, ...) are wrapped too, and make
+    the cache forget what they touch.
+
+    The cache only sees state changed through glad pointers. Call
+    gladStateCacheInvalidate after anything else touches the context (a
+    library with its own loader, a context switch, a lost context).
+
+    Install after glad_trace.h's layer to have the tracer count only the
+    calls that reach the driver, and uninstall layers in reverse order.
+
+*/
+
+#ifndef __glad_state_h_
+#define __glad_state_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct gladStateCacheStats {
+    unsigned long forwarded;           /* cached calls passed to the driver */
+    unsigned long elided;              /* cached calls dropped, all kinds */
+    unsigned long program_elided;      /* glUseProgram */
+    unsigned long vertex_array_elided; /* glBindVertexArray */
+    unsigned long buffer_elided;       /* glBindBuffer */
+    unsigned long texture_elided;      /* glActiveTexture, glBindTexture */
+    unsigned long uniform_elided;      /* glUniform* */
+};
+
+GLAPI int gladStateCacheInstall(void);
+GLAPI void gladStateCacheUninstall(void);
+GLAPI void gladStateCacheInvalidate(void);
+
+GLAPI void gladStateCacheGetStats(struct gladStateCacheStats *stats);
+GLAPI void gladStateCacheResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,61 @@
+/*
+
+    Per-frame GL call tracing for glad.
+
+    gladTraceInstall wraps every loaded glad_gl* pointer with a counting
+    shim, in the spirit of glad's debug pre/post callbacks, without
+    regenerating the loader. Call it after gladLoadGLLoader and call
+    gladTraceEndFrame once per frame (e.g. right before swapping buffers);
+    the query functions then describe the last completed frame.
+
+    Layers that wrap glad pointers (tracing, state caching) must be
+    uninstalled in the reverse order they were installed.
+
+*/
+
+#ifndef __glad_trace_h_
+#define __glad_trace_h_
+
+#include <stddef.h>
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct gladTraceStats {
+    unsigned long frame;            /* number of the frame described, from 1 */
+    unsigned long calls;            /* every traced GL call */
+    unsigned long draw_calls;       /* glDraw* except glDrawBuffer*, glMultiDraw* */
+    unsigned long state_calls;      /* binds, enables, blend/depth/raster state, draw buffers */
+    unsigned long uniform_calls;    /* glUniform* and glProgramUniform* */
+    GLuint64 buffer_upload_bytes;   /* data passed to glBufferData/SubData/Storage */
+    GLuint64 texture_upload_bytes;  /* pixels passed to glTex(Sub)Image2D/3D */
+};
+
+struct gladTraceCall {
+    const char *name;
+    unsigned long count;
+};
+
+GLAPI int gladTraceInstall(void);
+GLAPI void gladTraceUninstall(void);
+GLAPI void gladTraceEndFrame(void);
+
+GLAPI void gladTraceGetFrameStats(struct gladTraceStats *stats);
+GLAPI unsigned long gladTraceGetCallCount(const char *name);
+
+/* Fills calls with the most called functions of the last frame, most
+ * frequent first, and returns how many entries were written. */
+GLAPI int gladTraceGetTopCalls(struct gladTraceCall *calls, int max);
+
+/* Formats the last frame's stats and top calls as newline separated text
+ * for an on-screen overlay. Returns the length written, excluding the
+ * terminator; output is truncated to fit size. */
+GLAPI size_t gladTraceFormatFrame(char *buffer, size_t size, int top_calls);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
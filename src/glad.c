@@ -787,94 +787,181 @@ static int max_loaded_major;
 static int max_loaded_minor;
 
 static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+
+/* Extension names are indexed once per load into an open-addressed hash
+ * set, so each has_ext() query is a hash and a short probe instead of a
+ * scan over every extension the context reports.
+ *
+ * The set lives in a single arena: the slot table followed, on GL3+
+ * contexts, by the copied names. Slots hold offsets from exts_names, so
+ * the arena can grow with realloc() while it is being filled. On legacy
+ * contexts exts_names is the GL_EXTENSIONS string itself and nothing is
+ * copied. Everything is released by free_exts(). */
+struct glad_ext_slot {
+    size_t offset;
+    size_t len; /* 0 marks an empty slot */
+};
+
+static char *exts_arena = NULL;
+static size_t exts_arena_size = 0;
+static struct glad_ext_slot *exts_set = NULL;
+static size_t exts_set_mask = 0;
+static const char *exts_names = NULL;
+
+static size_t hash_ext(const char *name, size_t len) {
+    /* FNV-1a */
+    size_t index;
+    unsigned long hash = 2166136261UL;
+    for(index = 0; index < len; index++) {
+        hash ^= (unsigned char)name[index];
+        hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    return (size_t)hash;
+}
+
+static int init_exts_set(size_t count, size_t names_size) {
+    size_t size = 16;
+    size_t slots_size;
+    while(size < count * 2) {
+        size <<= 1;
+    }
+
+    slots_size = size * sizeof *exts_set;
+    exts_arena = (char *)malloc(slots_size + names_size);
+    if(exts_arena == NULL) {
+        return 0;
+    }
+    memset(exts_arena, 0, slots_size);
+    exts_arena_size = slots_size + names_size;
+    exts_set = (struct glad_ext_slot *)exts_arena;
+    exts_set_mask = size - 1;
+    return 1;
+}
+
+static size_t find_ext_slot(const char *name, size_t len) {
+    size_t slot = hash_ext(name, len) & exts_set_mask;
+    while(exts_set[slot].len != 0) {
+        if(exts_set[slot].len == len &&
+            memcmp(exts_names + exts_set[slot].offset, name, len) == 0) {
+            break;
+        }
+        slot = (slot + 1) & exts_set_mask;
+    }
+    return slot;
+}
+
+static int insert_ext(size_t offset, size_t len) {
+    size_t slot = find_ext_slot(exts_names + offset, len);
+    if(exts_set[slot].len != 0) {
+        return 0;
+    }
+    exts_set[slot].offset = offset;
+    exts_set[slot].len = len;
+    return 1;
+}
+
+static void free_exts(void) {
+    free((void *)exts_arena);
+    exts_arena = NULL;
+    exts_arena_size = 0;
+    exts_set = NULL;
+    exts_set_mask = 0;
+    exts_names = NULL;
+}
 
 static int get_exts(void) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
+        const char *cursor;
+        size_t count = 0;
+
         exts = (const char *)glGetString(GL_EXTENSIONS);
+        if(exts == NULL) {
+            return 1;
+        }
+
+        for(cursor = exts; *cursor != '\0'; cursor++) {
+            if(*cursor == ' ') count++;
+        }
+        if(!init_exts_set(count + 1, 0)) {
+            return 0;
+        }
+
+        exts_names = exts;
+        cursor = exts;
+        while(*cursor != '\0') {
+            size_t len = strcspn(cursor, " ");
+            if(len > 0) {
+                insert_ext((size_t)(cursor - exts), len);
+            }
+            cursor += len;
+            while(*cursor == ' ') cursor++;
+        }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         unsigned int index;
+        int num_exts_i = 0;
+        size_t names_start;
+        size_t names_used = 0;
 
-        num_exts_i = 0;
         glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
+        if (num_exts_i <= 0) {
+            /* No extensions: has_ext() reports none without a set. */
+            return 1;
         }
 
-        if (exts_i == NULL) {
+        /* Most extension names are well under 32 bytes, so this usually
+         * holds every name without growing. */
+        if (!init_exts_set((size_t)num_exts_i, (size_t)num_exts_i * 32)) {
             return 0;
         }
+        names_start = (exts_set_mask + 1) * sizeof *exts_set;
+        exts_names = exts_arena + names_start;
 
         for(index = 0; index < (unsigned)num_exts_i; index++) {
             const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+            size_t len;
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
+            if(gl_str_tmp == NULL) continue;
+            len = strlen(gl_str_tmp);
+            if(len == 0) continue;
+
+            if(names_start + names_used + len > exts_arena_size) {
+                size_t new_size = exts_arena_size * 2 + len;
+                char *new_arena = (char *)realloc(exts_arena, new_size);
+                if(new_arena == NULL) {
+                    free_exts();
+                    return 0;
+                }
+                exts_arena = new_arena;
+                exts_arena_size = new_size;
+                exts_set = (struct glad_ext_slot *)exts_arena;
+                exts_names = exts_arena + names_start;
+            }
+
+            memcpy(exts_arena + names_start + names_used, gl_str_tmp, len);
+            if(insert_ext(names_used, len)) {
+                names_used += len;
             }
-            exts_i[index] = local_str;
         }
     }
 #endif
     return 1;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
-    }
-}
-
 static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+    size_t len;
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
-        }
+    if(exts_set == NULL || ext == NULL) {
+        return 0;
     }
-#endif
 
-    return 0;
+    len = strlen(ext);
+    if(len == 0) {
+        return 0;
+    }
+    return exts_set[find_ext_slot(ext, len)].len != 0;
 }
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
@@ -0,0 +1,2653 @@
+/*
+
+    X-macro list of every GL entry point declared in glad/glad.h.
+    Generated by tools/glad_funcs.py; do not edit by hand.
+
+    GLAD_FUNC(ret, name, pfn, params, args)
+    GLAD_FUNC_VOID(name, pfn, params, args)
+
+    Entries are sorted by name in strcmp() order.
+
+*/
+
+GLAD_FUNC_VOID(glAccumxOES, PFNGLACCUMXOESPROC, (GLenum op, GLfixed value), (op, value))
+GLAD_FUNC(GLboolean, glAcquireKeyedMutexWin32EXT, PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC, (GLuint memory, GLuint64 key, GLuint timeout), (memory, key, timeout))
+GLAD_FUNC_VOID(glActiveProgramEXT, PFNGLACTIVEPROGRAMEXTPROC, (GLuint program), (program))
+GLAD_FUNC_VOID(glActiveShaderProgram, PFNGLACTIVESHADERPROGRAMPROC, (GLuint pipeline, GLuint program), (pipeline, program))
+GLAD_FUNC_VOID(glActiveShaderProgramEXT, PFNGLACTIVESHADERPROGRAMEXTPROC, (GLuint pipeline, GLuint program), (pipeline, program))
+GLAD_FUNC_VOID(glActiveStencilFaceEXT, PFNGLACTIVESTENCILFACEEXTPROC, (GLenum face), (face))
+GLAD_FUNC_VOID(glActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture))
+GLAD_FUNC_VOID(glActiveTextureARB, PFNGLACTIVETEXTUREARBPROC, (GLenum texture), (texture))
+GLAD_FUNC_VOID(glActiveVaryingNV, PFNGLACTIVEVARYINGNVPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_FUNC_VOID(glAlphaFragmentOp1ATI, PFNGLALPHAFRAGMENTOP1ATIPROC, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod))
+GLAD_FUNC_VOID(glAlphaFragmentOp2ATI, PFNGLALPHAFRAGMENTOP2ATIPROC, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod))
+GLAD_FUNC_VOID(glAlphaFragmentOp3ATI, PFNGLALPHAFRAGMENTOP3ATIPROC, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod))
+GLAD_FUNC_VOID(glAlphaFuncxOES, PFNGLALPHAFUNCXOESPROC, (GLenum func, GLfixed ref), (func, ref))
+GLAD_FUNC_VOID(glAlphaToCoverageDitherControlNV, PFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glApplyFramebufferAttachmentCMAAINTEL, PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC, (void), ())
+GLAD_FUNC_VOID(glApplyTextureEXT, PFNGLAPPLYTEXTUREEXTPROC, (GLenum mode), (mode))
+GLAD_FUNC(GLboolean, glAreProgramsResidentNV, PFNGLAREPROGRAMSRESIDENTNVPROC, (GLsizei n, const GLuint *programs, GLboolean *residences), (n, programs, residences))
+GLAD_FUNC(GLboolean, glAreTexturesResidentEXT, PFNGLARETEXTURESRESIDENTEXTPROC, (GLsizei n, const GLuint *textures, GLboolean *residences), (n, textures, residences))
+GLAD_FUNC_VOID(glArrayElementEXT, PFNGLARRAYELEMENTEXTPROC, (GLint i), (i))
+GLAD_FUNC_VOID(glArrayObjectATI, PFNGLARRAYOBJECTATIPROC, (GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset), (array, size, type, stride, buffer, offset))
+GLAD_FUNC(GLuint, glAsyncCopyBufferSubDataNVX, PFNGLASYNCCOPYBUFFERSUBDATANVXPROC, (GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *fenceValueArray, GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray), (waitSemaphoreCount, waitSemaphoreArray, fenceValueArray, readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size, signalSemaphoreCount, signalSemaphoreArray, signalValueArray))
+GLAD_FUNC(GLuint, glAsyncCopyImageSubDataNVX, PFNGLASYNCCOPYIMAGESUBDATANVXPROC, (GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *waitValueArray, GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray), (waitSemaphoreCount, waitSemaphoreArray, waitValueArray, srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth, signalSemaphoreCount, signalSemaphoreArray, signalValueArray))
+GLAD_FUNC_VOID(glAsyncMarkerSGIX, PFNGLASYNCMARKERSGIXPROC, (GLuint marker), (marker))
+GLAD_FUNC_VOID(glAttachObjectARB, PFNGLATTACHOBJECTARBPROC, (GLhandleARB containerObj, GLhandleARB obj), (containerObj, obj))
+GLAD_FUNC_VOID(glAttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_FUNC_VOID(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode))
+GLAD_FUNC_VOID(glBeginConditionalRenderNV, PFNGLBEGINCONDITIONALRENDERNVPROC, (GLuint id, GLenum mode), (id, mode))
+GLAD_FUNC_VOID(glBeginConditionalRenderNVX, PFNGLBEGINCONDITIONALRENDERNVXPROC, (GLuint id), (id))
+GLAD_FUNC_VOID(glBeginFragmentShaderATI, PFNGLBEGINFRAGMENTSHADERATIPROC, (void), ())
+GLAD_FUNC_VOID(glBeginOcclusionQueryNV, PFNGLBEGINOCCLUSIONQUERYNVPROC, (GLuint id), (id))
+GLAD_FUNC_VOID(glBeginPerfMonitorAMD, PFNGLBEGINPERFMONITORAMDPROC, (GLuint monitor), (monitor))
+GLAD_FUNC_VOID(glBeginPerfQueryINTEL, PFNGLBEGINPERFQUERYINTELPROC, (GLuint queryHandle), (queryHandle))
+GLAD_FUNC_VOID(glBeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id))
+GLAD_FUNC_VOID(glBeginQueryARB, PFNGLBEGINQUERYARBPROC, (GLenum target, GLuint id), (target, id))
+GLAD_FUNC_VOID(glBeginQueryIndexed, PFNGLBEGINQUERYINDEXEDPROC, (GLenum target, GLuint index, GLuint id), (target, index, id))
+GLAD_FUNC_VOID(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode))
+GLAD_FUNC_VOID(glBeginTransformFeedbackEXT, PFNGLBEGINTRANSFORMFEEDBACKEXTPROC, (GLenum primitiveMode), (primitiveMode))
+GLAD_FUNC_VOID(glBeginTransformFeedbackNV, PFNGLBEGINTRANSFORMFEEDBACKNVPROC, (GLenum primitiveMode), (primitiveMode))
+GLAD_FUNC_VOID(glBeginVertexShaderEXT, PFNGLBEGINVERTEXSHADEREXTPROC, (void), ())
+GLAD_FUNC_VOID(glBeginVideoCaptureNV, PFNGLBEGINVIDEOCAPTURENVPROC, (GLuint video_capture_slot), (video_capture_slot))
+GLAD_FUNC_VOID(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GLAD_FUNC_VOID(glBindAttribLocationARB, PFNGLBINDATTRIBLOCATIONARBPROC, (GLhandleARB programObj, GLuint index, const GLcharARB *name), (programObj, index, name))
+GLAD_FUNC_VOID(glBindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_FUNC_VOID(glBindBufferARB, PFNGLBINDBUFFERARBPROC, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_FUNC_VOID(glBindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_FUNC_VOID(glBindBufferBaseEXT, PFNGLBINDBUFFERBASEEXTPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_FUNC_VOID(glBindBufferBaseNV, PFNGLBINDBUFFERBASENVPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_FUNC_VOID(glBindBufferOffsetEXT, PFNGLBINDBUFFEROFFSETEXTPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset), (target, index, buffer, offset))
+GLAD_FUNC_VOID(glBindBufferOffsetNV, PFNGLBINDBUFFEROFFSETNVPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset), (target, index, buffer, offset))
+GLAD_FUNC_VOID(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_FUNC_VOID(glBindBufferRangeEXT, PFNGLBINDBUFFERRANGEEXTPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_FUNC_VOID(glBindBufferRangeNV, PFNGLBINDBUFFERRANGENVPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_FUNC_VOID(glBindBuffersBase, PFNGLBINDBUFFERSBASEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers))
+GLAD_FUNC_VOID(glBindBuffersRange, PFNGLBINDBUFFERSRANGEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes))
+GLAD_FUNC_VOID(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_FUNC_VOID(glBindFragDataLocationEXT, PFNGLBINDFRAGDATALOCATIONEXTPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_FUNC_VOID(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GLAD_FUNC_VOID(glBindFragmentShaderATI, PFNGLBINDFRAGMENTSHADERATIPROC, (GLuint id), (id))
+GLAD_FUNC_VOID(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_FUNC_VOID(glBindFramebufferEXT, PFNGLBINDFRAMEBUFFEREXTPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_FUNC_VOID(glBindImageTexture, PFNGLBINDIMAGETEXTUREPROC, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format))
+GLAD_FUNC_VOID(glBindImageTextureEXT, PFNGLBINDIMAGETEXTUREEXTPROC, (GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format), (index, texture, level, layered, layer, access, format))
+GLAD_FUNC_VOID(glBindImageTextures, PFNGLBINDIMAGETEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GLAD_FUNC(GLuint, glBindLightParameterEXT, PFNGLBINDLIGHTPARAMETEREXTPROC, (GLenum light, GLenum value), (light, value))
+GLAD_FUNC(GLuint, glBindMaterialParameterEXT, PFNGLBINDMATERIALPARAMETEREXTPROC, (GLenum face, GLenum value), (face, value))
+GLAD_FUNC_VOID(glBindMultiTextureEXT, PFNGLBINDMULTITEXTUREEXTPROC, (GLenum texunit, GLenum target, GLuint texture), (texunit, target, texture))
+GLAD_FUNC(GLuint, glBindParameterEXT, PFNGLBINDPARAMETEREXTPROC, (GLenum value), (value))
+GLAD_FUNC_VOID(glBindProgramARB, PFNGLBINDPROGRAMARBPROC, (GLenum target, GLuint program), (target, program))
+GLAD_FUNC_VOID(glBindProgramNV, PFNGLBINDPROGRAMNVPROC, (GLenum target, GLuint id), (target, id))
+GLAD_FUNC_VOID(glBindProgramPipeline, PFNGLBINDPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_FUNC_VOID(glBindProgramPipelineEXT, PFNGLBINDPROGRAMPIPELINEEXTPROC, (GLuint pipeline), (pipeline))
+GLAD_FUNC_VOID(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_FUNC_VOID(glBindRenderbufferEXT, PFNGLBINDRENDERBUFFEREXTPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_FUNC_VOID(glBindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler))
+GLAD_FUNC_VOID(glBindSamplers, PFNGLBINDSAMPLERSPROC, (GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers))
+GLAD_FUNC_VOID(glBindShadingRateImageNV, PFNGLBINDSHADINGRATEIMAGENVPROC, (GLuint texture), (texture))
+GLAD_FUNC(GLuint, glBindTexGenParameterEXT, PFNGLBINDTEXGENPARAMETEREXTPROC, (GLenum unit, GLenum coord, GLenum value), (unit, coord, value))
+GLAD_FUNC_VOID(glBindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture))
+GLAD_FUNC_VOID(glBindTextureEXT, PFNGLBINDTEXTUREEXTPROC, (GLenum target, GLuint texture), (target, texture))
+GLAD_FUNC_VOID(glBindTextureUnit, PFNGLBINDTEXTUREUNITPROC, (GLuint unit, GLuint texture), (unit, texture))
+GLAD_FUNC(GLuint, glBindTextureUnitParameterEXT, PFNGLBINDTEXTUREUNITPARAMETEREXTPROC, (GLenum unit, GLenum value), (unit, value))
+GLAD_FUNC_VOID(glBindTextures, PFNGLBINDTEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GLAD_FUNC_VOID(glBindTransformFeedback, PFNGLBINDTRANSFORMFEEDBACKPROC, (GLenum target, GLuint id), (target, id))
+GLAD_FUNC_VOID(glBindTransformFeedbackNV, PFNGLBINDTRANSFORMFEEDBACKNVPROC, (GLenum target, GLuint id), (target, id))
+GLAD_FUNC_VOID(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_FUNC_VOID(glBindVertexArrayAPPLE, PFNGLBINDVERTEXARRAYAPPLEPROC, (GLuint array), (array))
+GLAD_FUNC_VOID(glBindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride))
+GLAD_FUNC_VOID(glBindVertexBuffers, PFNGLBINDVERTEXBUFFERSPROC, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides))
+GLAD_FUNC_VOID(glBindVertexShaderEXT, PFNGLBINDVERTEXSHADEREXTPROC, (GLuint id), (id))
+GLAD_FUNC_VOID(glBindVideoCaptureStreamBufferNV, PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC, (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset), (video_capture_slot, stream, frame_region, offset))
+GLAD_FUNC_VOID(glBindVideoCaptureStreamTextureNV, PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC, (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLenum target, GLuint texture), (video_capture_slot, stream, frame_region, target, texture))
+GLAD_FUNC_VOID(glBinormal3bEXT, PFNGLBINORMAL3BEXTPROC, (GLbyte bx, GLbyte by, GLbyte bz), (bx, by, bz))
+GLAD_FUNC_VOID(glBinormal3bvEXT, PFNGLBINORMAL3BVEXTPROC, (const GLbyte *v), (v))
+GLAD_FUNC_VOID(glBinormal3dEXT, PFNGLBINORMAL3DEXTPROC, (GLdouble bx, GLdouble by, GLdouble bz), (bx, by, bz))
+GLAD_FUNC_VOID(glBinormal3dvEXT, PFNGLBINORMAL3DVEXTPROC, (const GLdouble *v), (v))
+GLAD_FUNC_VOID(glBinormal3fEXT, PFNGLBINORMAL3FEXTPROC, (GLfloat bx, GLfloat by, GLfloat bz), (bx, by, bz))
+GLAD_FUNC_VOID(glBinormal3fvEXT, PFNGLBINORMAL3FVEXTPROC, (const GLfloat *v), (v))
+GLAD_FUNC_VOID(glBinormal3iEXT, PFNGLBINORMAL3IEXTPROC, (GLint bx, GLint by, GLint bz), (bx, by, bz))
+GLAD_FUNC_VOID(glBinormal3ivEXT, PFNGLBINORMAL3IVEXTPROC, (const GLint *v), (v))
+GLAD_FUNC_VOID(glBinormal3sEXT, PFNGLBINORMAL3SEXTPROC, (GLshort bx, GLshort by, GLshort bz), (bx, by, bz))
+GLAD_FUNC_VOID(glBinormal3svEXT, PFNGLBINORMAL3SVEXTPROC, (const GLshort *v), (v))
+GLAD_FUNC_VOID(glBinormalPointerEXT, PFNGLBINORMALPOINTEREXTPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_FUNC_VOID(glBitmapxOES, PFNGLBITMAPXOESPROC, (GLsizei width, GLsizei height, GLfixed xorig, GLfixed yorig, GLfixed xmove, GLfixed ymove, const GLubyte *bitmap), (width, height, xorig, yorig, xmove, ymove, bitmap))
+GLAD_FUNC_VOID(glBlendBarrierKHR, PFNGLBLENDBARRIERKHRPROC, (void), ())
+GLAD_FUNC_VOID(glBlendBarrierNV, PFNGLBLENDBARRIERNVPROC, (void), ())
+GLAD_FUNC_VOID(glBlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glBlendColorEXT, PFNGLBLENDCOLOREXTPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glBlendColorxOES, PFNGLBLENDCOLORXOESPROC, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glBlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glBlendEquationEXT, PFNGLBLENDEQUATIONEXTPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glBlendEquationIndexedAMD, PFNGLBLENDEQUATIONINDEXEDAMDPROC, (GLuint buf, GLenum mode), (buf, mode))
+GLAD_FUNC_VOID(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_FUNC_VOID(glBlendEquationSeparateEXT, PFNGLBLENDEQUATIONSEPARATEEXTPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_FUNC_VOID(glBlendEquationSeparateIndexedAMD, PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GLAD_FUNC_VOID(glBlendEquationSeparateiARB, PFNGLBLENDEQUATIONSEPARATEIARBPROC, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GLAD_FUNC_VOID(glBlendEquationiARB, PFNGLBLENDEQUATIONIARBPROC, (GLuint buf, GLenum mode), (buf, mode))
+GLAD_FUNC_VOID(glBlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GLAD_FUNC_VOID(glBlendFuncIndexedAMD, PFNGLBLENDFUNCINDEXEDAMDPROC, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GLAD_FUNC_VOID(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_FUNC_VOID(glBlendFuncSeparateEXT, PFNGLBLENDFUNCSEPARATEEXTPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_FUNC_VOID(glBlendFuncSeparateINGR, PFNGLBLENDFUNCSEPARATEINGRPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_FUNC_VOID(glBlendFuncSeparateIndexedAMD, PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GLAD_FUNC_VOID(glBlendFuncSeparateiARB, PFNGLBLENDFUNCSEPARATEIARBPROC, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GLAD_FUNC_VOID(glBlendFunciARB, PFNGLBLENDFUNCIARBPROC, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GLAD_FUNC_VOID(glBlendParameteriNV, PFNGLBLENDPARAMETERINVPROC, (GLenum pname, GLint value), (pname, value))
+GLAD_FUNC_VOID(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_FUNC_VOID(glBlitFramebufferEXT, PFNGLBLITFRAMEBUFFEREXTPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_FUNC_VOID(glBlitFramebufferLayerEXT, PFNGLBLITFRAMEBUFFERLAYEREXTPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint srcLayer, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLint dstLayer, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, srcLayer, dstX0, dstY0, dstX1, dstY1, dstLayer, mask, filter))
+GLAD_FUNC_VOID(glBlitFramebufferLayersEXT, PFNGLBLITFRAMEBUFFERLAYERSEXTPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_FUNC_VOID(glBlitNamedFramebuffer, PFNGLBLITNAMEDFRAMEBUFFERPROC, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_FUNC_VOID(glBufferAddressRangeNV, PFNGLBUFFERADDRESSRANGENVPROC, (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length), (pname, index, address, length))
+GLAD_FUNC_VOID(glBufferAttachMemoryNV, PFNGLBUFFERATTACHMEMORYNVPROC, (GLenum target, GLuint memory, GLuint64 offset), (target, memory, offset))
+GLAD_FUNC_VOID(glBufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_FUNC_VOID(glBufferDataARB, PFNGLBUFFERDATAARBPROC, (GLenum target, GLsizeiptrARB size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_FUNC_VOID(glBufferPageCommitmentARB, PFNGLBUFFERPAGECOMMITMENTARBPROC, (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit), (target, offset, size, commit))
+GLAD_FUNC_VOID(glBufferPageCommitmentMemNV, PFNGLBUFFERPAGECOMMITMENTMEMNVPROC, (GLenum target, GLintptr offset, GLsizeiptr size, GLuint memory, GLuint64 memOffset, GLboolean commit), (target, offset, size, memory, memOffset, commit))
+GLAD_FUNC_VOID(glBufferParameteriAPPLE, PFNGLBUFFERPARAMETERIAPPLEPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_FUNC_VOID(glBufferStorage, PFNGLBUFFERSTORAGEPROC, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))
+GLAD_FUNC_VOID(glBufferStorageExternalEXT, PFNGLBUFFERSTORAGEEXTERNALEXTPROC, (GLenum target, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags), (target, offset, size, clientBuffer, flags))
+GLAD_FUNC_VOID(glBufferStorageMemEXT, PFNGLBUFFERSTORAGEMEMEXTPROC, (GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset), (target, size, memory, offset))
+GLAD_FUNC_VOID(glBufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GLAD_FUNC_VOID(glBufferSubDataARB, PFNGLBUFFERSUBDATAARBPROC, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void *data), (target, offset, size, data))
+GLAD_FUNC_VOID(glCallCommandListNV, PFNGLCALLCOMMANDLISTNVPROC, (GLuint list), (list))
+GLAD_FUNC(GLenum, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target))
+GLAD_FUNC(GLenum, glCheckFramebufferStatusEXT, PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC, (GLenum target), (target))
+GLAD_FUNC(GLenum, glCheckNamedFramebufferStatus, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, (GLuint framebuffer, GLenum target), (framebuffer, target))
+GLAD_FUNC(GLenum, glCheckNamedFramebufferStatusEXT, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC, (GLuint framebuffer, GLenum target), (framebuffer, target))
+GLAD_FUNC_VOID(glClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_FUNC_VOID(glClampColorARB, PFNGLCLAMPCOLORARBPROC, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_FUNC_VOID(glClear, PFNGLCLEARPROC, (GLbitfield mask), (mask))
+GLAD_FUNC_VOID(glClearAccumxOES, PFNGLCLEARACCUMXOESPROC, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glClearBufferData, PFNGLCLEARBUFFERDATAPROC, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data), (target, internalformat, format, type, data))
+GLAD_FUNC_VOID(glClearBufferSubData, PFNGLCLEARBUFFERSUBDATAPROC, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (target, internalformat, offset, size, format, type, data))
+GLAD_FUNC_VOID(glClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GLAD_FUNC_VOID(glClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GLAD_FUNC_VOID(glClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GLAD_FUNC_VOID(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GLAD_FUNC_VOID(glClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glClearColorIiEXT, PFNGLCLEARCOLORIIEXTPROC, (GLint red, GLint green, GLint blue, GLint alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glClearColorIuiEXT, PFNGLCLEARCOLORIUIEXTPROC, (GLuint red, GLuint green, GLuint blue, GLuint alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glClearColorxOES, PFNGLCLEARCOLORXOESPROC, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth))
+GLAD_FUNC_VOID(glClearDepthdNV, PFNGLCLEARDEPTHDNVPROC, (GLdouble depth), (depth))
+GLAD_FUNC_VOID(glClearDepthf, PFNGLCLEARDEPTHFPROC, (GLfloat d), (d))
+GLAD_FUNC_VOID(glClearDepthfOES, PFNGLCLEARDEPTHFOESPROC, (GLclampf depth), (depth))
+GLAD_FUNC_VOID(glClearDepthxOES, PFNGLCLEARDEPTHXOESPROC, (GLfixed depth), (depth))
+GLAD_FUNC_VOID(glClearNamedBufferData, PFNGLCLEARNAMEDBUFFERDATAPROC, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data))
+GLAD_FUNC_VOID(glClearNamedBufferDataEXT, PFNGLCLEARNAMEDBUFFERDATAEXTPROC, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data))
+GLAD_FUNC_VOID(glClearNamedBufferSubData, PFNGLCLEARNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data))
+GLAD_FUNC_VOID(glClearNamedBufferSubDataEXT, PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC, (GLuint buffer, GLenum internalformat, GLsizeiptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data))
+GLAD_FUNC_VOID(glClearNamedFramebufferfi, PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil))
+GLAD_FUNC_VOID(glClearNamedFramebufferfv, PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_FUNC_VOID(glClearNamedFramebufferiv, PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_FUNC_VOID(glClearNamedFramebufferuiv, PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_FUNC_VOID(glClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s))
+GLAD_FUNC_VOID(glClearTexImage, PFNGLCLEARTEXIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data), (texture, level, format, type, data))
+GLAD_FUNC_VOID(glClearTexSubImage, PFNGLCLEARTEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data))
+GLAD_FUNC_VOID(glClientActiveTextureARB, PFNGLCLIENTACTIVETEXTUREARBPROC, (GLenum texture), (texture))
+GLAD_FUNC_VOID(glClientActiveVertexStreamATI, PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC, (GLenum stream), (stream))
+GLAD_FUNC_VOID(glClientAttribDefaultEXT, PFNGLCLIENTATTRIBDEFAULTEXTPROC, (GLbitfield mask), (mask))
+GLAD_FUNC_VOID(glClientWaitSemaphoreui64NVX, PFNGLCLIENTWAITSEMAPHOREUI64NVXPROC, (GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (fenceObjectCount, semaphoreArray, fenceValueArray))
+GLAD_FUNC(GLenum, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_FUNC_VOID(glClipControl, PFNGLCLIPCONTROLPROC, (GLenum origin, GLenum depth), (origin, depth))
+GLAD_FUNC_VOID(glClipPlanefOES, PFNGLCLIPPLANEFOESPROC, (GLenum plane, const GLfloat *equation), (plane, equation))
+GLAD_FUNC_VOID(glClipPlanexOES, PFNGLCLIPPLANEXOESPROC, (GLenum plane, const GLfixed *equation), (plane, equation))
+GLAD_FUNC_VOID(glColor3fVertex3fSUN, PFNGLCOLOR3FVERTEX3FSUNPROC, (GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (r, g, b, x, y, z))
+GLAD_FUNC_VOID(glColor3fVertex3fvSUN, PFNGLCOLOR3FVERTEX3FVSUNPROC, (const GLfloat *c, const GLfloat *v), (c, v))
+GLAD_FUNC_VOID(glColor3hNV, PFNGLCOLOR3HNVPROC, (GLhalfNV red, GLhalfNV green, GLhalfNV blue), (red, green, blue))
+GLAD_FUNC_VOID(glColor3hvNV, PFNGLCOLOR3HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glColor3xOES, PFNGLCOLOR3XOESPROC, (GLfixed red, GLfixed green, GLfixed blue), (red, green, blue))
+GLAD_FUNC_VOID(glColor3xvOES, PFNGLCOLOR3XVOESPROC, (const GLfixed *components), (components))
+GLAD_FUNC_VOID(glColor4fNormal3fVertex3fSUN, PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC, (GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (r, g, b, a, nx, ny, nz, x, y, z))
+GLAD_FUNC_VOID(glColor4fNormal3fVertex3fvSUN, PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC, (const GLfloat *c, const GLfloat *n, const GLfloat *v), (c, n, v))
+GLAD_FUNC_VOID(glColor4hNV, PFNGLCOLOR4HNVPROC, (GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glColor4hvNV, PFNGLCOLOR4HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glColor4ubVertex2fSUN, PFNGLCOLOR4UBVERTEX2FSUNPROC, (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y), (r, g, b, a, x, y))
+GLAD_FUNC_VOID(glColor4ubVertex2fvSUN, PFNGLCOLOR4UBVERTEX2FVSUNPROC, (const GLubyte *c, const GLfloat *v), (c, v))
+GLAD_FUNC_VOID(glColor4ubVertex3fSUN, PFNGLCOLOR4UBVERTEX3FSUNPROC, (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (r, g, b, a, x, y, z))
+GLAD_FUNC_VOID(glColor4ubVertex3fvSUN, PFNGLCOLOR4UBVERTEX3FVSUNPROC, (const GLubyte *c, const GLfloat *v), (c, v))
+GLAD_FUNC_VOID(glColor4xOES, PFNGLCOLOR4XOESPROC, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glColor4xvOES, PFNGLCOLOR4XVOESPROC, (const GLfixed *components), (components))
+GLAD_FUNC_VOID(glColorFormatNV, PFNGLCOLORFORMATNVPROC, (GLint size, GLenum type, GLsizei stride), (size, type, stride))
+GLAD_FUNC_VOID(glColorFragmentOp1ATI, PFNGLCOLORFRAGMENTOP1ATIPROC, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod))
+GLAD_FUNC_VOID(glColorFragmentOp2ATI, PFNGLCOLORFRAGMENTOP2ATIPROC, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod))
+GLAD_FUNC_VOID(glColorFragmentOp3ATI, PFNGLCOLORFRAGMENTOP3ATIPROC, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod))
+GLAD_FUNC_VOID(glColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glColorMaskIndexedEXT, PFNGLCOLORMASKINDEXEDEXTPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_FUNC_VOID(glColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_FUNC_VOID(glColorP3ui, PFNGLCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_FUNC_VOID(glColorP3uiv, PFNGLCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_FUNC_VOID(glColorP4ui, PFNGLCOLORP4UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_FUNC_VOID(glColorP4uiv, PFNGLCOLORP4UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_FUNC_VOID(glColorPointerEXT, PFNGLCOLORPOINTEREXTPROC, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer))
+GLAD_FUNC_VOID(glColorPointerListIBM, PFNGLCOLORPOINTERLISTIBMPROC, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride))
+GLAD_FUNC_VOID(glColorPointervINTEL, PFNGLCOLORPOINTERVINTELPROC, (GLint size, GLenum type, const void **pointer), (size, type, pointer))
+GLAD_FUNC_VOID(glColorSubTable, PFNGLCOLORSUBTABLEPROC, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data), (target, start, count, format, type, data))
+GLAD_FUNC_VOID(glColorSubTableEXT, PFNGLCOLORSUBTABLEEXTPROC, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data), (target, start, count, format, type, data))
+GLAD_FUNC_VOID(glColorTable, PFNGLCOLORTABLEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table), (target, internalformat, width, format, type, table))
+GLAD_FUNC_VOID(glColorTableEXT, PFNGLCOLORTABLEEXTPROC, (GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const void *table), (target, internalFormat, width, format, type, table))
+GLAD_FUNC_VOID(glColorTableParameterfv, PFNGLCOLORTABLEPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glColorTableParameterfvSGI, PFNGLCOLORTABLEPARAMETERFVSGIPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glColorTableParameteriv, PFNGLCOLORTABLEPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glColorTableParameterivSGI, PFNGLCOLORTABLEPARAMETERIVSGIPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glColorTableSGI, PFNGLCOLORTABLESGIPROC, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table), (target, internalformat, width, format, type, table))
+GLAD_FUNC_VOID(glCombinerInputNV, PFNGLCOMBINERINPUTNVPROC, (GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage), (stage, portion, variable, input, mapping, componentUsage))
+GLAD_FUNC_VOID(glCombinerOutputNV, PFNGLCOMBINEROUTPUTNVPROC, (GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum), (stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum))
+GLAD_FUNC_VOID(glCombinerParameterfNV, PFNGLCOMBINERPARAMETERFNVPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glCombinerParameterfvNV, PFNGLCOMBINERPARAMETERFVNVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glCombinerParameteriNV, PFNGLCOMBINERPARAMETERINVPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glCombinerParameterivNV, PFNGLCOMBINERPARAMETERIVNVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_FUNC_VOID(glCombinerStageParameterfvNV, PFNGLCOMBINERSTAGEPARAMETERFVNVPROC, (GLenum stage, GLenum pname, const GLfloat *params), (stage, pname, params))
+GLAD_FUNC_VOID(glCommandListSegmentsNV, PFNGLCOMMANDLISTSEGMENTSNVPROC, (GLuint list, GLuint segments), (list, segments))
+GLAD_FUNC_VOID(glCompileCommandListNV, PFNGLCOMPILECOMMANDLISTNVPROC, (GLuint list), (list))
+GLAD_FUNC_VOID(glCompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader))
+GLAD_FUNC_VOID(glCompileShaderARB, PFNGLCOMPILESHADERARBPROC, (GLhandleARB shaderObj), (shaderObj))
+GLAD_FUNC_VOID(glCompileShaderIncludeARB, PFNGLCOMPILESHADERINCLUDEARBPROC, (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length), (shader, count, path, length))
+GLAD_FUNC_VOID(glCompressedMultiTexImage1DEXT, PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, border, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedMultiTexImage2DEXT, PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, height, border, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedMultiTexImage3DEXT, PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, height, depth, border, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedMultiTexSubImage1DEXT, PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, width, format, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedMultiTexSubImage2DEXT, PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, yoffset, width, height, format, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedMultiTexSubImage3DEXT, PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexImage1DARB, PFNGLCOMPRESSEDTEXIMAGE1DARBPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexImage2DARB, PFNGLCOMPRESSEDTEXIMAGE2DARBPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexImage3DARB, PFNGLCOMPRESSEDTEXIMAGE3DARBPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexSubImage1DARB, PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexSubImage2DARB, PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTexSubImage3DARB, PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTextureImage1DEXT, PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, border, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedTextureImage2DEXT, PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, height, border, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedTextureImage3DEXT, PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, height, depth, border, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedTextureSubImage1D, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, width, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTextureSubImage1DEXT, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, width, format, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedTextureSubImage2D, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTextureSubImage2DEXT, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, yoffset, width, height, format, imageSize, bits))
+GLAD_FUNC_VOID(glCompressedTextureSubImage3D, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_FUNC_VOID(glCompressedTextureSubImage3DEXT, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits))
+GLAD_FUNC_VOID(glConservativeRasterParameterfNV, PFNGLCONSERVATIVERASTERPARAMETERFNVPROC, (GLenum pname, GLfloat value), (pname, value))
+GLAD_FUNC_VOID(glConservativeRasterParameteriNV, PFNGLCONSERVATIVERASTERPARAMETERINVPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glConvolutionFilter1D, PFNGLCONVOLUTIONFILTER1DPROC, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image), (target, internalformat, width, format, type, image))
+GLAD_FUNC_VOID(glConvolutionFilter1DEXT, PFNGLCONVOLUTIONFILTER1DEXTPROC, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image), (target, internalformat, width, format, type, image))
+GLAD_FUNC_VOID(glConvolutionFilter2D, PFNGLCONVOLUTIONFILTER2DPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image), (target, internalformat, width, height, format, type, image))
+GLAD_FUNC_VOID(glConvolutionFilter2DEXT, PFNGLCONVOLUTIONFILTER2DEXTPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image), (target, internalformat, width, height, format, type, image))
+GLAD_FUNC_VOID(glConvolutionParameterf, PFNGLCONVOLUTIONPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat params), (target, pname, params))
+GLAD_FUNC_VOID(glConvolutionParameterfEXT, PFNGLCONVOLUTIONPARAMETERFEXTPROC, (GLenum target, GLenum pname, GLfloat params), (target, pname, params))
+GLAD_FUNC_VOID(glConvolutionParameterfv, PFNGLCONVOLUTIONPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glConvolutionParameterfvEXT, PFNGLCONVOLUTIONPARAMETERFVEXTPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glConvolutionParameteri, PFNGLCONVOLUTIONPARAMETERIPROC, (GLenum target, GLenum pname, GLint params), (target, pname, params))
+GLAD_FUNC_VOID(glConvolutionParameteriEXT, PFNGLCONVOLUTIONPARAMETERIEXTPROC, (GLenum target, GLenum pname, GLint params), (target, pname, params))
+GLAD_FUNC_VOID(glConvolutionParameteriv, PFNGLCONVOLUTIONPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glConvolutionParameterivEXT, PFNGLCONVOLUTIONPARAMETERIVEXTPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glConvolutionParameterxOES, PFNGLCONVOLUTIONPARAMETERXOESPROC, (GLenum target, GLenum pname, GLfixed param), (target, pname, param))
+GLAD_FUNC_VOID(glConvolutionParameterxvOES, PFNGLCONVOLUTIONPARAMETERXVOESPROC, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params))
+GLAD_FUNC_VOID(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GLAD_FUNC_VOID(glCopyColorSubTable, PFNGLCOPYCOLORSUBTABLEPROC, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width), (target, start, x, y, width))
+GLAD_FUNC_VOID(glCopyColorSubTableEXT, PFNGLCOPYCOLORSUBTABLEEXTPROC, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width), (target, start, x, y, width))
+GLAD_FUNC_VOID(glCopyColorTable, PFNGLCOPYCOLORTABLEPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GLAD_FUNC_VOID(glCopyColorTableSGI, PFNGLCOPYCOLORTABLESGIPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GLAD_FUNC_VOID(glCopyConvolutionFilter1D, PFNGLCOPYCONVOLUTIONFILTER1DPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GLAD_FUNC_VOID(glCopyConvolutionFilter1DEXT, PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GLAD_FUNC_VOID(glCopyConvolutionFilter2D, PFNGLCOPYCONVOLUTIONFILTER2DPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height), (target, internalformat, x, y, width, height))
+GLAD_FUNC_VOID(glCopyConvolutionFilter2DEXT, PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height), (target, internalformat, x, y, width, height))
+GLAD_FUNC_VOID(glCopyImageSubData, PFNGLCOPYIMAGESUBDATAPROC, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth))
+GLAD_FUNC_VOID(glCopyImageSubDataNV, PFNGLCOPYIMAGESUBDATANVPROC, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth))
+GLAD_FUNC_VOID(glCopyMultiTexImage1DEXT, PFNGLCOPYMULTITEXIMAGE1DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (texunit, target, level, internalformat, x, y, width, border))
+GLAD_FUNC_VOID(glCopyMultiTexImage2DEXT, PFNGLCOPYMULTITEXIMAGE2DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (texunit, target, level, internalformat, x, y, width, height, border))
+GLAD_FUNC_VOID(glCopyMultiTexSubImage1DEXT, PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texunit, target, level, xoffset, x, y, width))
+GLAD_FUNC_VOID(glCopyMultiTexSubImage2DEXT, PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texunit, target, level, xoffset, yoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyMultiTexSubImage3DEXT, PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyNamedBufferSubData, PFNGLCOPYNAMEDBUFFERSUBDATAPROC, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size))
+GLAD_FUNC_VOID(glCopyPathNV, PFNGLCOPYPATHNVPROC, (GLuint resultPath, GLuint srcPath), (resultPath, srcPath))
+GLAD_FUNC_VOID(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_FUNC_VOID(glCopyTexImage1DEXT, PFNGLCOPYTEXIMAGE1DEXTPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_FUNC_VOID(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_FUNC_VOID(glCopyTexImage2DEXT, PFNGLCOPYTEXIMAGE2DEXTPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_FUNC_VOID(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_FUNC_VOID(glCopyTexSubImage1DEXT, PFNGLCOPYTEXSUBIMAGE1DEXTPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_FUNC_VOID(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyTexSubImage2DEXT, PFNGLCOPYTEXSUBIMAGE2DEXTPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyTexSubImage3DEXT, PFNGLCOPYTEXSUBIMAGE3DEXTPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyTextureImage1DEXT, PFNGLCOPYTEXTUREIMAGE1DEXTPROC, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (texture, target, level, internalformat, x, y, width, border))
+GLAD_FUNC_VOID(glCopyTextureImage2DEXT, PFNGLCOPYTEXTUREIMAGE2DEXTPROC, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (texture, target, level, internalformat, x, y, width, height, border))
+GLAD_FUNC_VOID(glCopyTextureSubImage1D, PFNGLCOPYTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width))
+GLAD_FUNC_VOID(glCopyTextureSubImage1DEXT, PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, target, level, xoffset, x, y, width))
+GLAD_FUNC_VOID(glCopyTextureSubImage2D, PFNGLCOPYTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyTextureSubImage2DEXT, PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, target, level, xoffset, yoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyTextureSubImage3D, PFNGLCOPYTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCopyTextureSubImage3DEXT, PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_FUNC_VOID(glCoverFillPathInstancedNV, PFNGLCOVERFILLPATHINSTANCEDNVPROC, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues))
+GLAD_FUNC_VOID(glCoverFillPathNV, PFNGLCOVERFILLPATHNVPROC, (GLuint path, GLenum coverMode), (path, coverMode))
+GLAD_FUNC_VOID(glCoverStrokePathInstancedNV, PFNGLCOVERSTROKEPATHINSTANCEDNVPROC, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues))
+GLAD_FUNC_VOID(glCoverStrokePathNV, PFNGLCOVERSTROKEPATHNVPROC, (GLuint path, GLenum coverMode), (path, coverMode))
+GLAD_FUNC_VOID(glCoverageModulationNV, PFNGLCOVERAGEMODULATIONNVPROC, (GLenum components), (components))
+GLAD_FUNC_VOID(glCoverageModulationTableNV, PFNGLCOVERAGEMODULATIONTABLENVPROC, (GLsizei n, const GLfloat *v), (n, v))
+GLAD_FUNC_VOID(glCreateBuffers, PFNGLCREATEBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_FUNC_VOID(glCreateCommandListsNV, PFNGLCREATECOMMANDLISTSNVPROC, (GLsizei n, GLuint *lists), (n, lists))
+GLAD_FUNC_VOID(glCreateFramebuffers, PFNGLCREATEFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_FUNC_VOID(glCreateMemoryObjectsEXT, PFNGLCREATEMEMORYOBJECTSEXTPROC, (GLsizei n, GLuint *memoryObjects), (n, memoryObjects))
+GLAD_FUNC_VOID(glCreatePerfQueryINTEL, PFNGLCREATEPERFQUERYINTELPROC, (GLuint queryId, GLuint *queryHandle), (queryId, queryHandle))
+GLAD_FUNC(GLuint, glCreateProgram, PFNGLCREATEPROGRAMPROC, (void), ())
+GLAD_FUNC(GLhandleARB, glCreateProgramObjectARB, PFNGLCREATEPROGRAMOBJECTARBPROC, (void), ())
+GLAD_FUNC_VOID(glCreateProgramPipelines, PFNGLCREATEPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_FUNC(GLuint, glCreateProgressFenceNVX, PFNGLCREATEPROGRESSFENCENVXPROC, (void), ())
+GLAD_FUNC_VOID(glCreateQueries, PFNGLCREATEQUERIESPROC, (GLenum target, GLsizei n, GLuint *ids), (target, n, ids))
+GLAD_FUNC_VOID(glCreateRenderbuffers, PFNGLCREATERENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_FUNC_VOID(glCreateSamplers, PFNGLCREATESAMPLERSPROC, (GLsizei n, GLuint *samplers), (n, samplers))
+GLAD_FUNC_VOID(glCreateSemaphoresNV, PFNGLCREATESEMAPHORESNVPROC, (GLsizei n, GLuint *semaphores), (n, semaphores))
+GLAD_FUNC(GLuint, glCreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type))
+GLAD_FUNC(GLhandleARB, glCreateShaderObjectARB, PFNGLCREATESHADEROBJECTARBPROC, (GLenum shaderType), (shaderType))
+GLAD_FUNC(GLuint, glCreateShaderProgramEXT, PFNGLCREATESHADERPROGRAMEXTPROC, (GLenum type, const GLchar *string), (type, string))
+GLAD_FUNC(GLuint, glCreateShaderProgramv, PFNGLCREATESHADERPROGRAMVPROC, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings))
+GLAD_FUNC(GLuint, glCreateShaderProgramvEXT, PFNGLCREATESHADERPROGRAMVEXTPROC, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings))
+GLAD_FUNC_VOID(glCreateStatesNV, PFNGLCREATESTATESNVPROC, (GLsizei n, GLuint *states), (n, states))
+GLAD_FUNC(GLsync, glCreateSyncFromCLeventARB, PFNGLCREATESYNCFROMCLEVENTARBPROC, (struct _cl_context *context, struct _cl_event *event, GLbitfield flags), (context, event, flags))
+GLAD_FUNC_VOID(glCreateTextures, PFNGLCREATETEXTURESPROC, (GLenum target, GLsizei n, GLuint *textures), (target, n, textures))
+GLAD_FUNC_VOID(glCreateTransformFeedbacks, PFNGLCREATETRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glCreateVertexArrays, PFNGLCREATEVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_FUNC_VOID(glCullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glCullParameterdvEXT, PFNGLCULLPARAMETERDVEXTPROC, (GLenum pname, GLdouble *params), (pname, params))
+GLAD_FUNC_VOID(glCullParameterfvEXT, PFNGLCULLPARAMETERFVEXTPROC, (GLenum pname, GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glCurrentPaletteMatrixARB, PFNGLCURRENTPALETTEMATRIXARBPROC, (GLint index), (index))
+GLAD_FUNC_VOID(glDebugMessageCallback, PFNGLDEBUGMESSAGECALLBACKPROC, (GLDEBUGPROC callback, const void *userParam), (callback, userParam))
+GLAD_FUNC_VOID(glDebugMessageCallbackAMD, PFNGLDEBUGMESSAGECALLBACKAMDPROC, (GLDEBUGPROCAMD callback, void *userParam), (callback, userParam))
+GLAD_FUNC_VOID(glDebugMessageCallbackARB, PFNGLDEBUGMESSAGECALLBACKARBPROC, (GLDEBUGPROCARB callback, const void *userParam), (callback, userParam))
+GLAD_FUNC_VOID(glDebugMessageCallbackKHR, PFNGLDEBUGMESSAGECALLBACKKHRPROC, (GLDEBUGPROCKHR callback, const void *userParam), (callback, userParam))
+GLAD_FUNC_VOID(glDebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GLAD_FUNC_VOID(glDebugMessageControlARB, PFNGLDEBUGMESSAGECONTROLARBPROC, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GLAD_FUNC_VOID(glDebugMessageControlKHR, PFNGLDEBUGMESSAGECONTROLKHRPROC, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GLAD_FUNC_VOID(glDebugMessageEnableAMD, PFNGLDEBUGMESSAGEENABLEAMDPROC, (GLenum category, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (category, severity, count, ids, enabled))
+GLAD_FUNC_VOID(glDebugMessageInsert, PFNGLDEBUGMESSAGEINSERTPROC, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GLAD_FUNC_VOID(glDebugMessageInsertAMD, PFNGLDEBUGMESSAGEINSERTAMDPROC, (GLenum category, GLenum severity, GLuint id, GLsizei length, const GLchar *buf), (category, severity, id, length, buf))
+GLAD_FUNC_VOID(glDebugMessageInsertARB, PFNGLDEBUGMESSAGEINSERTARBPROC, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GLAD_FUNC_VOID(glDebugMessageInsertKHR, PFNGLDEBUGMESSAGEINSERTKHRPROC, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GLAD_FUNC_VOID(glDeformSGIX, PFNGLDEFORMSGIXPROC, (GLbitfield mask), (mask))
+GLAD_FUNC_VOID(glDeformationMap3dSGIX, PFNGLDEFORMATIONMAP3DSGIXPROC, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points))
+GLAD_FUNC_VOID(glDeformationMap3fSGIX, PFNGLDEFORMATIONMAP3FSGIXPROC, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, GLfloat w1, GLfloat w2, GLint wstride, GLint worder, const GLfloat *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points))
+GLAD_FUNC_VOID(glDeleteAsyncMarkersSGIX, PFNGLDELETEASYNCMARKERSSGIXPROC, (GLuint marker, GLsizei range), (marker, range))
+GLAD_FUNC_VOID(glDeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_FUNC_VOID(glDeleteBuffersARB, PFNGLDELETEBUFFERSARBPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_FUNC_VOID(glDeleteCommandListsNV, PFNGLDELETECOMMANDLISTSNVPROC, (GLsizei n, const GLuint *lists), (n, lists))
+GLAD_FUNC_VOID(glDeleteFencesAPPLE, PFNGLDELETEFENCESAPPLEPROC, (GLsizei n, const GLuint *fences), (n, fences))
+GLAD_FUNC_VOID(glDeleteFencesNV, PFNGLDELETEFENCESNVPROC, (GLsizei n, const GLuint *fences), (n, fences))
+GLAD_FUNC_VOID(glDeleteFragmentShaderATI, PFNGLDELETEFRAGMENTSHADERATIPROC, (GLuint id), (id))
+GLAD_FUNC_VOID(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_FUNC_VOID(glDeleteFramebuffersEXT, PFNGLDELETEFRAMEBUFFERSEXTPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_FUNC_VOID(glDeleteMemoryObjectsEXT, PFNGLDELETEMEMORYOBJECTSEXTPROC, (GLsizei n, const GLuint *memoryObjects), (n, memoryObjects))
+GLAD_FUNC_VOID(glDeleteNamedStringARB, PFNGLDELETENAMEDSTRINGARBPROC, (GLint namelen, const GLchar *name), (namelen, name))
+GLAD_FUNC_VOID(glDeleteNamesAMD, PFNGLDELETENAMESAMDPROC, (GLenum identifier, GLuint num, const GLuint *names), (identifier, num, names))
+GLAD_FUNC_VOID(glDeleteObjectARB, PFNGLDELETEOBJECTARBPROC, (GLhandleARB obj), (obj))
+GLAD_FUNC_VOID(glDeleteOcclusionQueriesNV, PFNGLDELETEOCCLUSIONQUERIESNVPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glDeletePathsNV, PFNGLDELETEPATHSNVPROC, (GLuint path, GLsizei range), (path, range))
+GLAD_FUNC_VOID(glDeletePerfMonitorsAMD, PFNGLDELETEPERFMONITORSAMDPROC, (GLsizei n, GLuint *monitors), (n, monitors))
+GLAD_FUNC_VOID(glDeletePerfQueryINTEL, PFNGLDELETEPERFQUERYINTELPROC, (GLuint queryHandle), (queryHandle))
+GLAD_FUNC_VOID(glDeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program))
+GLAD_FUNC_VOID(glDeleteProgramPipelines, PFNGLDELETEPROGRAMPIPELINESPROC, (GLsizei n, const GLuint *pipelines), (n, pipelines))
+GLAD_FUNC_VOID(glDeleteProgramPipelinesEXT, PFNGLDELETEPROGRAMPIPELINESEXTPROC, (GLsizei n, const GLuint *pipelines), (n, pipelines))
+GLAD_FUNC_VOID(glDeleteProgramsARB, PFNGLDELETEPROGRAMSARBPROC, (GLsizei n, const GLuint *programs), (n, programs))
+GLAD_FUNC_VOID(glDeleteProgramsNV, PFNGLDELETEPROGRAMSNVPROC, (GLsizei n, const GLuint *programs), (n, programs))
+GLAD_FUNC_VOID(glDeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glDeleteQueriesARB, PFNGLDELETEQUERIESARBPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glDeleteQueryResourceTagNV, PFNGLDELETEQUERYRESOURCETAGNVPROC, (GLsizei n, const GLint *tagIds), (n, tagIds))
+GLAD_FUNC_VOID(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_FUNC_VOID(glDeleteRenderbuffersEXT, PFNGLDELETERENDERBUFFERSEXTPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_FUNC_VOID(glDeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers))
+GLAD_FUNC_VOID(glDeleteSemaphoresEXT, PFNGLDELETESEMAPHORESEXTPROC, (GLsizei n, const GLuint *semaphores), (n, semaphores))
+GLAD_FUNC_VOID(glDeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader))
+GLAD_FUNC_VOID(glDeleteStatesNV, PFNGLDELETESTATESNVPROC, (GLsizei n, const GLuint *states), (n, states))
+GLAD_FUNC_VOID(glDeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync))
+GLAD_FUNC_VOID(glDeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_FUNC_VOID(glDeleteTexturesEXT, PFNGLDELETETEXTURESEXTPROC, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_FUNC_VOID(glDeleteTransformFeedbacks, PFNGLDELETETRANSFORMFEEDBACKSPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glDeleteTransformFeedbacksNV, PFNGLDELETETRANSFORMFEEDBACKSNVPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_FUNC_VOID(glDeleteVertexArraysAPPLE, PFNGLDELETEVERTEXARRAYSAPPLEPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_FUNC_VOID(glDeleteVertexShaderEXT, PFNGLDELETEVERTEXSHADEREXTPROC, (GLuint id), (id))
+GLAD_FUNC_VOID(glDepthBoundsEXT, PFNGLDEPTHBOUNDSEXTPROC, (GLclampd zmin, GLclampd zmax), (zmin, zmax))
+GLAD_FUNC_VOID(glDepthBoundsdNV, PFNGLDEPTHBOUNDSDNVPROC, (GLdouble zmin, GLdouble zmax), (zmin, zmax))
+GLAD_FUNC_VOID(glDepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func))
+GLAD_FUNC_VOID(glDepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag))
+GLAD_FUNC_VOID(glDepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f))
+GLAD_FUNC_VOID(glDepthRangeArraydvNV, PFNGLDEPTHRANGEARRAYDVNVPROC, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v))
+GLAD_FUNC_VOID(glDepthRangeArrayv, PFNGLDEPTHRANGEARRAYVPROC, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v))
+GLAD_FUNC_VOID(glDepthRangeIndexed, PFNGLDEPTHRANGEINDEXEDPROC, (GLuint index, GLdouble n, GLdouble f), (index, n, f))
+GLAD_FUNC_VOID(glDepthRangeIndexeddNV, PFNGLDEPTHRANGEINDEXEDDNVPROC, (GLuint index, GLdouble n, GLdouble f), (index, n, f))
+GLAD_FUNC_VOID(glDepthRangedNV, PFNGLDEPTHRANGEDNVPROC, (GLdouble zNear, GLdouble zFar), (zNear, zFar))
+GLAD_FUNC_VOID(glDepthRangef, PFNGLDEPTHRANGEFPROC, (GLfloat n, GLfloat f), (n, f))
+GLAD_FUNC_VOID(glDepthRangefOES, PFNGLDEPTHRANGEFOESPROC, (GLclampf n, GLclampf f), (n, f))
+GLAD_FUNC_VOID(glDepthRangexOES, PFNGLDEPTHRANGEXOESPROC, (GLfixed n, GLfixed f), (n, f))
+GLAD_FUNC_VOID(glDetachObjectARB, PFNGLDETACHOBJECTARBPROC, (GLhandleARB containerObj, GLhandleARB attachedObj), (containerObj, attachedObj))
+GLAD_FUNC_VOID(glDetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_FUNC_VOID(glDetailTexFuncSGIS, PFNGLDETAILTEXFUNCSGISPROC, (GLenum target, GLsizei n, const GLfloat *points), (target, n, points))
+GLAD_FUNC_VOID(glDisable, PFNGLDISABLEPROC, (GLenum cap), (cap))
+GLAD_FUNC_VOID(glDisableClientStateIndexedEXT, PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC, (GLenum array, GLuint index), (array, index))
+GLAD_FUNC_VOID(glDisableClientStateiEXT, PFNGLDISABLECLIENTSTATEIEXTPROC, (GLenum array, GLuint index), (array, index))
+GLAD_FUNC_VOID(glDisableIndexedEXT, PFNGLDISABLEINDEXEDEXTPROC, (GLenum target, GLuint index), (target, index))
+GLAD_FUNC_VOID(glDisableVariantClientStateEXT, PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC, (GLuint id), (id))
+GLAD_FUNC_VOID(glDisableVertexArrayAttrib, PFNGLDISABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_FUNC_VOID(glDisableVertexArrayAttribEXT, PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_FUNC_VOID(glDisableVertexArrayEXT, PFNGLDISABLEVERTEXARRAYEXTPROC, (GLuint vaobj, GLenum array), (vaobj, array))
+GLAD_FUNC_VOID(glDisableVertexAttribAPPLE, PFNGLDISABLEVERTEXATTRIBAPPLEPROC, (GLuint index, GLenum pname), (index, pname))
+GLAD_FUNC_VOID(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_FUNC_VOID(glDisableVertexAttribArrayARB, PFNGLDISABLEVERTEXATTRIBARRAYARBPROC, (GLuint index), (index))
+GLAD_FUNC_VOID(glDisablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_FUNC_VOID(glDispatchCompute, PFNGLDISPATCHCOMPUTEPROC, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z))
+GLAD_FUNC_VOID(glDispatchComputeGroupSizeARB, PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z), (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z))
+GLAD_FUNC_VOID(glDispatchComputeIndirect, PFNGLDISPATCHCOMPUTEINDIRECTPROC, (GLintptr indirect), (indirect))
+GLAD_FUNC_VOID(glDrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_FUNC_VOID(glDrawArraysEXT, PFNGLDRAWARRAYSEXTPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_FUNC_VOID(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect), (mode, indirect))
+GLAD_FUNC_VOID(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GLAD_FUNC_VOID(glDrawArraysInstancedARB, PFNGLDRAWARRAYSINSTANCEDARBPROC, (GLenum mode, GLint first, GLsizei count, GLsizei primcount), (mode, first, count, primcount))
+GLAD_FUNC_VOID(glDrawArraysInstancedBaseInstance, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance))
+GLAD_FUNC_VOID(glDrawArraysInstancedEXT, PFNGLDRAWARRAYSINSTANCEDEXTPROC, (GLenum mode, GLint start, GLsizei count, GLsizei primcount), (mode, start, count, primcount))
+GLAD_FUNC_VOID(glDrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf))
+GLAD_FUNC_VOID(glDrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_FUNC_VOID(glDrawBuffersARB, PFNGLDRAWBUFFERSARBPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_FUNC_VOID(glDrawBuffersATI, PFNGLDRAWBUFFERSATIPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_FUNC_VOID(glDrawCommandsAddressNV, PFNGLDRAWCOMMANDSADDRESSNVPROC, (GLenum primitiveMode, const GLuint64 *indirects, const GLsizei *sizes, GLuint count), (primitiveMode, indirects, sizes, count))
+GLAD_FUNC_VOID(glDrawCommandsNV, PFNGLDRAWCOMMANDSNVPROC, (GLenum primitiveMode, GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, GLuint count), (primitiveMode, buffer, indirects, sizes, count))
+GLAD_FUNC_VOID(glDrawCommandsStatesAddressNV, PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC, (const GLuint64 *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (indirects, sizes, states, fbos, count))
+GLAD_FUNC_VOID(glDrawCommandsStatesNV, PFNGLDRAWCOMMANDSSTATESNVPROC, (GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (buffer, indirects, sizes, states, fbos, count))
+GLAD_FUNC_VOID(glDrawElementArrayAPPLE, PFNGLDRAWELEMENTARRAYAPPLEPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_FUNC_VOID(glDrawElementArrayATI, PFNGLDRAWELEMENTARRAYATIPROC, (GLenum mode, GLsizei count), (mode, count))
+GLAD_FUNC_VOID(glDrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GLAD_FUNC_VOID(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GLAD_FUNC_VOID(glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect))
+GLAD_FUNC_VOID(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GLAD_FUNC_VOID(glDrawElementsInstancedARB, PFNGLDRAWELEMENTSINSTANCEDARBPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount), (mode, count, type, indices, primcount))
+GLAD_FUNC_VOID(glDrawElementsInstancedBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance))
+GLAD_FUNC_VOID(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GLAD_FUNC_VOID(glDrawElementsInstancedBaseVertexBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance))
+GLAD_FUNC_VOID(glDrawElementsInstancedEXT, PFNGLDRAWELEMENTSINSTANCEDEXTPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount), (mode, count, type, indices, primcount))
+GLAD_FUNC_VOID(glDrawMeshArraysSUN, PFNGLDRAWMESHARRAYSSUNPROC, (GLenum mode, GLint first, GLsizei count, GLsizei width), (mode, first, count, width))
+GLAD_FUNC_VOID(glDrawMeshTasksEXT, PFNGLDRAWMESHTASKSEXTPROC, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z))
+GLAD_FUNC_VOID(glDrawMeshTasksIndirectEXT, PFNGLDRAWMESHTASKSINDIRECTEXTPROC, (GLintptr indirect), (indirect))
+GLAD_FUNC_VOID(glDrawMeshTasksIndirectNV, PFNGLDRAWMESHTASKSINDIRECTNVPROC, (GLintptr indirect), (indirect))
+GLAD_FUNC_VOID(glDrawMeshTasksNV, PFNGLDRAWMESHTASKSNVPROC, (GLuint first, GLuint count), (first, count))
+GLAD_FUNC_VOID(glDrawRangeElementArrayAPPLE, PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC, (GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count), (mode, start, end, first, count))
+GLAD_FUNC_VOID(glDrawRangeElementArrayATI, PFNGLDRAWRANGEELEMENTARRAYATIPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count), (mode, start, end, count))
+GLAD_FUNC_VOID(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_FUNC_VOID(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GLAD_FUNC_VOID(glDrawRangeElementsEXT, PFNGLDRAWRANGEELEMENTSEXTPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_FUNC_VOID(glDrawTextureNV, PFNGLDRAWTEXTURENVPROC, (GLuint texture, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1), (texture, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1))
+GLAD_FUNC_VOID(glDrawTransformFeedback, PFNGLDRAWTRANSFORMFEEDBACKPROC, (GLenum mode, GLuint id), (mode, id))
+GLAD_FUNC_VOID(glDrawTransformFeedbackInstanced, PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount))
+GLAD_FUNC_VOID(glDrawTransformFeedbackNV, PFNGLDRAWTRANSFORMFEEDBACKNVPROC, (GLenum mode, GLuint id), (mode, id))
+GLAD_FUNC_VOID(glDrawTransformFeedbackStream, PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream))
+GLAD_FUNC_VOID(glDrawTransformFeedbackStreamInstanced, PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount))
+GLAD_FUNC_VOID(glDrawVkImageNV, PFNGLDRAWVKIMAGENVPROC, (GLuint64 vkImage, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1), (vkImage, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1))
+GLAD_FUNC_VOID(glEGLImageTargetTexStorageEXT, PFNGLEGLIMAGETARGETTEXSTORAGEEXTPROC, (GLenum target, GLeglImageOES image, const GLint* attrib_list), (target, image, attrib_list))
+GLAD_FUNC_VOID(glEGLImageTargetTextureStorageEXT, PFNGLEGLIMAGETARGETTEXTURESTORAGEEXTPROC, (GLuint texture, GLeglImageOES image, const GLint* attrib_list), (texture, image, attrib_list))
+GLAD_FUNC_VOID(glEdgeFlagFormatNV, PFNGLEDGEFLAGFORMATNVPROC, (GLsizei stride), (stride))
+GLAD_FUNC_VOID(glEdgeFlagPointerEXT, PFNGLEDGEFLAGPOINTEREXTPROC, (GLsizei stride, GLsizei count, const GLboolean *pointer), (stride, count, pointer))
+GLAD_FUNC_VOID(glEdgeFlagPointerListIBM, PFNGLEDGEFLAGPOINTERLISTIBMPROC, (GLint stride, const GLboolean **pointer, GLint ptrstride), (stride, pointer, ptrstride))
+GLAD_FUNC_VOID(glElementPointerAPPLE, PFNGLELEMENTPOINTERAPPLEPROC, (GLenum type, const void *pointer), (type, pointer))
+GLAD_FUNC_VOID(glElementPointerATI, PFNGLELEMENTPOINTERATIPROC, (GLenum type, const void *pointer), (type, pointer))
+GLAD_FUNC_VOID(glEnable, PFNGLENABLEPROC, (GLenum cap), (cap))
+GLAD_FUNC_VOID(glEnableClientStateIndexedEXT, PFNGLENABLECLIENTSTATEINDEXEDEXTPROC, (GLenum array, GLuint index), (array, index))
+GLAD_FUNC_VOID(glEnableClientStateiEXT, PFNGLENABLECLIENTSTATEIEXTPROC, (GLenum array, GLuint index), (array, index))
+GLAD_FUNC_VOID(glEnableIndexedEXT, PFNGLENABLEINDEXEDEXTPROC, (GLenum target, GLuint index), (target, index))
+GLAD_FUNC_VOID(glEnableVariantClientStateEXT, PFNGLENABLEVARIANTCLIENTSTATEEXTPROC, (GLuint id), (id))
+GLAD_FUNC_VOID(glEnableVertexArrayAttrib, PFNGLENABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_FUNC_VOID(glEnableVertexArrayAttribEXT, PFNGLENABLEVERTEXARRAYATTRIBEXTPROC, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_FUNC_VOID(glEnableVertexArrayEXT, PFNGLENABLEVERTEXARRAYEXTPROC, (GLuint vaobj, GLenum array), (vaobj, array))
+GLAD_FUNC_VOID(glEnableVertexAttribAPPLE, PFNGLENABLEVERTEXATTRIBAPPLEPROC, (GLuint index, GLenum pname), (index, pname))
+GLAD_FUNC_VOID(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_FUNC_VOID(glEnableVertexAttribArrayARB, PFNGLENABLEVERTEXATTRIBARRAYARBPROC, (GLuint index), (index))
+GLAD_FUNC_VOID(glEnablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_FUNC_VOID(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), ())
+GLAD_FUNC_VOID(glEndConditionalRenderNV, PFNGLENDCONDITIONALRENDERNVPROC, (void), ())
+GLAD_FUNC_VOID(glEndConditionalRenderNVX, PFNGLENDCONDITIONALRENDERNVXPROC, (void), ())
+GLAD_FUNC_VOID(glEndFragmentShaderATI, PFNGLENDFRAGMENTSHADERATIPROC, (void), ())
+GLAD_FUNC_VOID(glEndOcclusionQueryNV, PFNGLENDOCCLUSIONQUERYNVPROC, (void), ())
+GLAD_FUNC_VOID(glEndPerfMonitorAMD, PFNGLENDPERFMONITORAMDPROC, (GLuint monitor), (monitor))
+GLAD_FUNC_VOID(glEndPerfQueryINTEL, PFNGLENDPERFQUERYINTELPROC, (GLuint queryHandle), (queryHandle))
+GLAD_FUNC_VOID(glEndQuery, PFNGLENDQUERYPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glEndQueryARB, PFNGLENDQUERYARBPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glEndQueryIndexed, PFNGLENDQUERYINDEXEDPROC, (GLenum target, GLuint index), (target, index))
+GLAD_FUNC_VOID(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), ())
+GLAD_FUNC_VOID(glEndTransformFeedbackEXT, PFNGLENDTRANSFORMFEEDBACKEXTPROC, (void), ())
+GLAD_FUNC_VOID(glEndTransformFeedbackNV, PFNGLENDTRANSFORMFEEDBACKNVPROC, (void), ())
+GLAD_FUNC_VOID(glEndVertexShaderEXT, PFNGLENDVERTEXSHADEREXTPROC, (void), ())
+GLAD_FUNC_VOID(glEndVideoCaptureNV, PFNGLENDVIDEOCAPTURENVPROC, (GLuint video_capture_slot), (video_capture_slot))
+GLAD_FUNC_VOID(glEvalCoord1xOES, PFNGLEVALCOORD1XOESPROC, (GLfixed u), (u))
+GLAD_FUNC_VOID(glEvalCoord1xvOES, PFNGLEVALCOORD1XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glEvalCoord2xOES, PFNGLEVALCOORD2XOESPROC, (GLfixed u, GLfixed v), (u, v))
+GLAD_FUNC_VOID(glEvalCoord2xvOES, PFNGLEVALCOORD2XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glEvalMapsNV, PFNGLEVALMAPSNVPROC, (GLenum target, GLenum mode), (target, mode))
+GLAD_FUNC_VOID(glEvaluateDepthValuesARB, PFNGLEVALUATEDEPTHVALUESARBPROC, (void), ())
+GLAD_FUNC_VOID(glExecuteProgramNV, PFNGLEXECUTEPROGRAMNVPROC, (GLenum target, GLuint id, const GLfloat *params), (target, id, params))
+GLAD_FUNC_VOID(glExtractComponentEXT, PFNGLEXTRACTCOMPONENTEXTPROC, (GLuint res, GLuint src, GLuint num), (res, src, num))
+GLAD_FUNC_VOID(glFeedbackBufferxOES, PFNGLFEEDBACKBUFFERXOESPROC, (GLsizei n, GLenum type, const GLfixed *buffer), (n, type, buffer))
+GLAD_FUNC(GLsync, glFenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags))
+GLAD_FUNC_VOID(glFinalCombinerInputNV, PFNGLFINALCOMBINERINPUTNVPROC, (GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage), (variable, input, mapping, componentUsage))
+GLAD_FUNC_VOID(glFinish, PFNGLFINISHPROC, (void), ())
+GLAD_FUNC(GLint, glFinishAsyncSGIX, PFNGLFINISHASYNCSGIXPROC, (GLuint *markerp), (markerp))
+GLAD_FUNC_VOID(glFinishFenceAPPLE, PFNGLFINISHFENCEAPPLEPROC, (GLuint fence), (fence))
+GLAD_FUNC_VOID(glFinishFenceNV, PFNGLFINISHFENCENVPROC, (GLuint fence), (fence))
+GLAD_FUNC_VOID(glFinishObjectAPPLE, PFNGLFINISHOBJECTAPPLEPROC, (GLenum object, GLint name), (object, name))
+GLAD_FUNC_VOID(glFinishTextureSUNX, PFNGLFINISHTEXTURESUNXPROC, (void), ())
+GLAD_FUNC_VOID(glFlush, PFNGLFLUSHPROC, (void), ())
+GLAD_FUNC_VOID(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GLAD_FUNC_VOID(glFlushMappedBufferRangeAPPLE, PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC, (GLenum target, GLintptr offset, GLsizeiptr size), (target, offset, size))
+GLAD_FUNC_VOID(glFlushMappedNamedBufferRange, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_FUNC_VOID(glFlushMappedNamedBufferRangeEXT, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_FUNC_VOID(glFlushPixelDataRangeNV, PFNGLFLUSHPIXELDATARANGENVPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glFlushRasterSGIX, PFNGLFLUSHRASTERSGIXPROC, (void), ())
+GLAD_FUNC_VOID(glFlushStaticDataIBM, PFNGLFLUSHSTATICDATAIBMPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glFlushVertexArrayRangeAPPLE, PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC, (GLsizei length, void *pointer), (length, pointer))
+GLAD_FUNC_VOID(glFlushVertexArrayRangeNV, PFNGLFLUSHVERTEXARRAYRANGENVPROC, (void), ())
+GLAD_FUNC_VOID(glFogCoordFormatNV, PFNGLFOGCOORDFORMATNVPROC, (GLenum type, GLsizei stride), (type, stride))
+GLAD_FUNC_VOID(glFogCoordPointerEXT, PFNGLFOGCOORDPOINTEREXTPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_FUNC_VOID(glFogCoordPointerListIBM, PFNGLFOGCOORDPOINTERLISTIBMPROC, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride))
+GLAD_FUNC_VOID(glFogCoorddEXT, PFNGLFOGCOORDDEXTPROC, (GLdouble coord), (coord))
+GLAD_FUNC_VOID(glFogCoorddvEXT, PFNGLFOGCOORDDVEXTPROC, (const GLdouble *coord), (coord))
+GLAD_FUNC_VOID(glFogCoordfEXT, PFNGLFOGCOORDFEXTPROC, (GLfloat coord), (coord))
+GLAD_FUNC_VOID(glFogCoordfvEXT, PFNGLFOGCOORDFVEXTPROC, (const GLfloat *coord), (coord))
+GLAD_FUNC_VOID(glFogCoordhNV, PFNGLFOGCOORDHNVPROC, (GLhalfNV fog), (fog))
+GLAD_FUNC_VOID(glFogCoordhvNV, PFNGLFOGCOORDHVNVPROC, (const GLhalfNV *fog), (fog))
+GLAD_FUNC_VOID(glFogFuncSGIS, PFNGLFOGFUNCSGISPROC, (GLsizei n, const GLfloat *points), (n, points))
+GLAD_FUNC_VOID(glFogxOES, PFNGLFOGXOESPROC, (GLenum pname, GLfixed param), (pname, param))
+GLAD_FUNC_VOID(glFogxvOES, PFNGLFOGXVOESPROC, (GLenum pname, const GLfixed *param), (pname, param))
+GLAD_FUNC_VOID(glFragmentColorMaterialSGIX, PFNGLFRAGMENTCOLORMATERIALSGIXPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_FUNC_VOID(glFragmentCoverageColorNV, PFNGLFRAGMENTCOVERAGECOLORNVPROC, (GLuint color), (color))
+GLAD_FUNC_VOID(glFragmentLightModelfSGIX, PFNGLFRAGMENTLIGHTMODELFSGIXPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glFragmentLightModelfvSGIX, PFNGLFRAGMENTLIGHTMODELFVSGIXPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glFragmentLightModeliSGIX, PFNGLFRAGMENTLIGHTMODELISGIXPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glFragmentLightModelivSGIX, PFNGLFRAGMENTLIGHTMODELIVSGIXPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_FUNC_VOID(glFragmentLightfSGIX, PFNGLFRAGMENTLIGHTFSGIXPROC, (GLenum light, GLenum pname, GLfloat param), (light, pname, param))
+GLAD_FUNC_VOID(glFragmentLightfvSGIX, PFNGLFRAGMENTLIGHTFVSGIXPROC, (GLenum light, GLenum pname, const GLfloat *params), (light, pname, params))
+GLAD_FUNC_VOID(glFragmentLightiSGIX, PFNGLFRAGMENTLIGHTISGIXPROC, (GLenum light, GLenum pname, GLint param), (light, pname, param))
+GLAD_FUNC_VOID(glFragmentLightivSGIX, PFNGLFRAGMENTLIGHTIVSGIXPROC, (GLenum light, GLenum pname, const GLint *params), (light, pname, params))
+GLAD_FUNC_VOID(glFragmentMaterialfSGIX, PFNGLFRAGMENTMATERIALFSGIXPROC, (GLenum face, GLenum pname, GLfloat param), (face, pname, param))
+GLAD_FUNC_VOID(glFragmentMaterialfvSGIX, PFNGLFRAGMENTMATERIALFVSGIXPROC, (GLenum face, GLenum pname, const GLfloat *params), (face, pname, params))
+GLAD_FUNC_VOID(glFragmentMaterialiSGIX, PFNGLFRAGMENTMATERIALISGIXPROC, (GLenum face, GLenum pname, GLint param), (face, pname, param))
+GLAD_FUNC_VOID(glFragmentMaterialivSGIX, PFNGLFRAGMENTMATERIALIVSGIXPROC, (GLenum face, GLenum pname, const GLint *params), (face, pname, params))
+GLAD_FUNC_VOID(glFrameTerminatorGREMEDY, PFNGLFRAMETERMINATORGREMEDYPROC, (void), ())
+GLAD_FUNC_VOID(glFrameZoomSGIX, PFNGLFRAMEZOOMSGIXPROC, (GLint factor), (factor))
+GLAD_FUNC_VOID(glFramebufferDrawBufferEXT, PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC, (GLuint framebuffer, GLenum mode), (framebuffer, mode))
+GLAD_FUNC_VOID(glFramebufferDrawBuffersEXT, PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs))
+GLAD_FUNC_VOID(glFramebufferFetchBarrierEXT, PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC, (void), ())
+GLAD_FUNC_VOID(glFramebufferParameteri, PFNGLFRAMEBUFFERPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_FUNC_VOID(glFramebufferParameteriMESA, PFNGLFRAMEBUFFERPARAMETERIMESAPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_FUNC_VOID(glFramebufferReadBufferEXT, PFNGLFRAMEBUFFERREADBUFFEREXTPROC, (GLuint framebuffer, GLenum mode), (framebuffer, mode))
+GLAD_FUNC_VOID(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_FUNC_VOID(glFramebufferRenderbufferEXT, PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_FUNC_VOID(glFramebufferSampleLocationsfvARB, PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC, (GLenum target, GLuint start, GLsizei count, const GLfloat *v), (target, start, count, v))
+GLAD_FUNC_VOID(glFramebufferSampleLocationsfvNV, PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC, (GLenum target, GLuint start, GLsizei count, const GLfloat *v), (target, start, count, v))
+GLAD_FUNC_VOID(glFramebufferSamplePositionsfvAMD, PFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC, (GLenum target, GLuint numsamples, GLuint pixelindex, const GLfloat *values), (target, numsamples, pixelindex, values))
+GLAD_FUNC_VOID(glFramebufferShadingRateEXT, PFNGLFRAMEBUFFERSHADINGRATEEXTPROC, (GLenum target, GLenum attachment, GLuint texture, GLint baseLayer, GLsizei numLayers, GLsizei texelWidth, GLsizei texelHeight), (target, attachment, texture, baseLayer, numLayers, texelWidth, texelHeight))
+GLAD_FUNC_VOID(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_FUNC_VOID(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_FUNC_VOID(glFramebufferTexture1DEXT, PFNGLFRAMEBUFFERTEXTURE1DEXTPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_FUNC_VOID(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_FUNC_VOID(glFramebufferTexture2DEXT, PFNGLFRAMEBUFFERTEXTURE2DEXTPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_FUNC_VOID(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_FUNC_VOID(glFramebufferTexture3DEXT, PFNGLFRAMEBUFFERTEXTURE3DEXTPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_FUNC_VOID(glFramebufferTextureARB, PFNGLFRAMEBUFFERTEXTUREARBPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_FUNC_VOID(glFramebufferTextureEXT, PFNGLFRAMEBUFFERTEXTUREEXTPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_FUNC_VOID(glFramebufferTextureFaceARB, PFNGLFRAMEBUFFERTEXTUREFACEARBPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face), (target, attachment, texture, level, face))
+GLAD_FUNC_VOID(glFramebufferTextureFaceEXT, PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face), (target, attachment, texture, level, face))
+GLAD_FUNC_VOID(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_FUNC_VOID(glFramebufferTextureLayerARB, PFNGLFRAMEBUFFERTEXTURELAYERARBPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_FUNC_VOID(glFramebufferTextureLayerEXT, PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_FUNC_VOID(glFramebufferTextureMultiviewOVR, PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews), (target, attachment, texture, level, baseViewIndex, numViews))
+GLAD_FUNC_VOID(glFreeObjectBufferATI, PFNGLFREEOBJECTBUFFERATIPROC, (GLuint buffer), (buffer))
+GLAD_FUNC_VOID(glFrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glFrustumfOES, PFNGLFRUSTUMFOESPROC, (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f), (l, r, b, t, n, f))
+GLAD_FUNC_VOID(glFrustumxOES, PFNGLFRUSTUMXOESPROC, (GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f), (l, r, b, t, n, f))
+GLAD_FUNC(GLuint, glGenAsyncMarkersSGIX, PFNGLGENASYNCMARKERSSGIXPROC, (GLsizei range), (range))
+GLAD_FUNC_VOID(glGenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_FUNC_VOID(glGenBuffersARB, PFNGLGENBUFFERSARBPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_FUNC_VOID(glGenFencesAPPLE, PFNGLGENFENCESAPPLEPROC, (GLsizei n, GLuint *fences), (n, fences))
+GLAD_FUNC_VOID(glGenFencesNV, PFNGLGENFENCESNVPROC, (GLsizei n, GLuint *fences), (n, fences))
+GLAD_FUNC(GLuint, glGenFragmentShadersATI, PFNGLGENFRAGMENTSHADERSATIPROC, (GLuint range), (range))
+GLAD_FUNC_VOID(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_FUNC_VOID(glGenFramebuffersEXT, PFNGLGENFRAMEBUFFERSEXTPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_FUNC_VOID(glGenNamesAMD, PFNGLGENNAMESAMDPROC, (GLenum identifier, GLuint num, GLuint *names), (identifier, num, names))
+GLAD_FUNC_VOID(glGenOcclusionQueriesNV, PFNGLGENOCCLUSIONQUERIESNVPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_FUNC(GLuint, glGenPathsNV, PFNGLGENPATHSNVPROC, (GLsizei range), (range))
+GLAD_FUNC_VOID(glGenPerfMonitorsAMD, PFNGLGENPERFMONITORSAMDPROC, (GLsizei n, GLuint *monitors), (n, monitors))
+GLAD_FUNC_VOID(glGenProgramPipelines, PFNGLGENPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_FUNC_VOID(glGenProgramPipelinesEXT, PFNGLGENPROGRAMPIPELINESEXTPROC, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_FUNC_VOID(glGenProgramsARB, PFNGLGENPROGRAMSARBPROC, (GLsizei n, GLuint *programs), (n, programs))
+GLAD_FUNC_VOID(glGenProgramsNV, PFNGLGENPROGRAMSNVPROC, (GLsizei n, GLuint *programs), (n, programs))
+GLAD_FUNC_VOID(glGenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glGenQueriesARB, PFNGLGENQUERIESARBPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glGenQueryResourceTagNV, PFNGLGENQUERYRESOURCETAGNVPROC, (GLsizei n, GLint *tagIds), (n, tagIds))
+GLAD_FUNC_VOID(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_FUNC_VOID(glGenRenderbuffersEXT, PFNGLGENRENDERBUFFERSEXTPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_FUNC_VOID(glGenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers))
+GLAD_FUNC_VOID(glGenSemaphoresEXT, PFNGLGENSEMAPHORESEXTPROC, (GLsizei n, GLuint *semaphores), (n, semaphores))
+GLAD_FUNC(GLuint, glGenSymbolsEXT, PFNGLGENSYMBOLSEXTPROC, (GLenum datatype, GLenum storagetype, GLenum range, GLuint components), (datatype, storagetype, range, components))
+GLAD_FUNC_VOID(glGenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_FUNC_VOID(glGenTexturesEXT, PFNGLGENTEXTURESEXTPROC, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_FUNC_VOID(glGenTransformFeedbacks, PFNGLGENTRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glGenTransformFeedbacksNV, PFNGLGENTRANSFORMFEEDBACKSNVPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_FUNC_VOID(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_FUNC_VOID(glGenVertexArraysAPPLE, PFNGLGENVERTEXARRAYSAPPLEPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_FUNC(GLuint, glGenVertexShadersEXT, PFNGLGENVERTEXSHADERSEXTPROC, (GLuint range), (range))
+GLAD_FUNC_VOID(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glGenerateMipmapEXT, PFNGLGENERATEMIPMAPEXTPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glGenerateMultiTexMipmapEXT, PFNGLGENERATEMULTITEXMIPMAPEXTPROC, (GLenum texunit, GLenum target), (texunit, target))
+GLAD_FUNC_VOID(glGenerateTextureMipmap, PFNGLGENERATETEXTUREMIPMAPPROC, (GLuint texture), (texture))
+GLAD_FUNC_VOID(glGenerateTextureMipmapEXT, PFNGLGENERATETEXTUREMIPMAPEXTPROC, (GLuint texture, GLenum target), (texture, target))
+GLAD_FUNC_VOID(glGetActiveAtomicCounterBufferiv, PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params), (program, bufferIndex, pname, params))
+GLAD_FUNC_VOID(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_FUNC_VOID(glGetActiveAttribARB, PFNGLGETACTIVEATTRIBARBPROC, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name), (programObj, index, maxLength, length, size, type, name))
+GLAD_FUNC_VOID(glGetActiveSubroutineName, PFNGLGETACTIVESUBROUTINENAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name))
+GLAD_FUNC_VOID(glGetActiveSubroutineUniformName, PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name))
+GLAD_FUNC_VOID(glGetActiveSubroutineUniformiv, PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values))
+GLAD_FUNC_VOID(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_FUNC_VOID(glGetActiveUniformARB, PFNGLGETACTIVEUNIFORMARBPROC, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name), (programObj, index, maxLength, length, size, type, name))
+GLAD_FUNC_VOID(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GLAD_FUNC_VOID(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GLAD_FUNC_VOID(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GLAD_FUNC_VOID(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GLAD_FUNC_VOID(glGetActiveVaryingNV, PFNGLGETACTIVEVARYINGNVPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_FUNC_VOID(glGetArrayObjectfvATI, PFNGLGETARRAYOBJECTFVATIPROC, (GLenum array, GLenum pname, GLfloat *params), (array, pname, params))
+GLAD_FUNC_VOID(glGetArrayObjectivATI, PFNGLGETARRAYOBJECTIVATIPROC, (GLenum array, GLenum pname, GLint *params), (array, pname, params))
+GLAD_FUNC_VOID(glGetAttachedObjectsARB, PFNGLGETATTACHEDOBJECTSARBPROC, (GLhandleARB containerObj, GLsizei maxCount, GLsizei *count, GLhandleARB *obj), (containerObj, maxCount, count, obj))
+GLAD_FUNC_VOID(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GLAD_FUNC(GLint, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_FUNC(GLint, glGetAttribLocationARB, PFNGLGETATTRIBLOCATIONARBPROC, (GLhandleARB programObj, const GLcharARB *name), (programObj, name))
+GLAD_FUNC_VOID(glGetBooleanIndexedvEXT, PFNGLGETBOOLEANINDEXEDVEXTPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_FUNC_VOID(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_FUNC_VOID(glGetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data))
+GLAD_FUNC_VOID(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetBufferParameterivARB, PFNGLGETBUFFERPARAMETERIVARBPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetBufferParameterui64vNV, PFNGLGETBUFFERPARAMETERUI64VNVPROC, (GLenum target, GLenum pname, GLuint64EXT *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_FUNC_VOID(glGetBufferPointervARB, PFNGLGETBUFFERPOINTERVARBPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_FUNC_VOID(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GLAD_FUNC_VOID(glGetBufferSubDataARB, PFNGLGETBUFFERSUBDATAARBPROC, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, void *data), (target, offset, size, data))
+GLAD_FUNC_VOID(glGetClipPlanefOES, PFNGLGETCLIPPLANEFOESPROC, (GLenum plane, GLfloat *equation), (plane, equation))
+GLAD_FUNC_VOID(glGetClipPlanexOES, PFNGLGETCLIPPLANEXOESPROC, (GLenum plane, GLfixed *equation), (plane, equation))
+GLAD_FUNC_VOID(glGetColorTable, PFNGLGETCOLORTABLEPROC, (GLenum target, GLenum format, GLenum type, void *table), (target, format, type, table))
+GLAD_FUNC_VOID(glGetColorTableEXT, PFNGLGETCOLORTABLEEXTPROC, (GLenum target, GLenum format, GLenum type, void *data), (target, format, type, data))
+GLAD_FUNC_VOID(glGetColorTableParameterfv, PFNGLGETCOLORTABLEPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetColorTableParameterfvEXT, PFNGLGETCOLORTABLEPARAMETERFVEXTPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetColorTableParameterfvSGI, PFNGLGETCOLORTABLEPARAMETERFVSGIPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetColorTableParameteriv, PFNGLGETCOLORTABLEPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetColorTableParameterivEXT, PFNGLGETCOLORTABLEPARAMETERIVEXTPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetColorTableParameterivSGI, PFNGLGETCOLORTABLEPARAMETERIVSGIPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetColorTableSGI, PFNGLGETCOLORTABLESGIPROC, (GLenum target, GLenum format, GLenum type, void *table), (target, format, type, table))
+GLAD_FUNC_VOID(glGetCombinerInputParameterfvNV, PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC, (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat *params), (stage, portion, variable, pname, params))
+GLAD_FUNC_VOID(glGetCombinerInputParameterivNV, PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC, (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint *params), (stage, portion, variable, pname, params))
+GLAD_FUNC_VOID(glGetCombinerOutputParameterfvNV, PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC, (GLenum stage, GLenum portion, GLenum pname, GLfloat *params), (stage, portion, pname, params))
+GLAD_FUNC_VOID(glGetCombinerOutputParameterivNV, PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC, (GLenum stage, GLenum portion, GLenum pname, GLint *params), (stage, portion, pname, params))
+GLAD_FUNC_VOID(glGetCombinerStageParameterfvNV, PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC, (GLenum stage, GLenum pname, GLfloat *params), (stage, pname, params))
+GLAD_FUNC(GLuint, glGetCommandHeaderNV, PFNGLGETCOMMANDHEADERNVPROC, (GLenum tokenID, GLuint size), (tokenID, size))
+GLAD_FUNC_VOID(glGetCompressedMultiTexImageEXT, PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC, (GLenum texunit, GLenum target, GLint lod, void *img), (texunit, target, lod, img))
+GLAD_FUNC_VOID(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_FUNC_VOID(glGetCompressedTexImageARB, PFNGLGETCOMPRESSEDTEXIMAGEARBPROC, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_FUNC_VOID(glGetCompressedTextureImage, PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLsizei bufSize, void *pixels), (texture, level, bufSize, pixels))
+GLAD_FUNC_VOID(glGetCompressedTextureImageEXT, PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC, (GLuint texture, GLenum target, GLint lod, void *img), (texture, target, lod, img))
+GLAD_FUNC_VOID(glGetCompressedTextureSubImage, PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels))
+GLAD_FUNC_VOID(glGetConvolutionFilter, PFNGLGETCONVOLUTIONFILTERPROC, (GLenum target, GLenum format, GLenum type, void *image), (target, format, type, image))
+GLAD_FUNC_VOID(glGetConvolutionFilterEXT, PFNGLGETCONVOLUTIONFILTEREXTPROC, (GLenum target, GLenum format, GLenum type, void *image), (target, format, type, image))
+GLAD_FUNC_VOID(glGetConvolutionParameterfv, PFNGLGETCONVOLUTIONPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetConvolutionParameterfvEXT, PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetConvolutionParameteriv, PFNGLGETCONVOLUTIONPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetConvolutionParameterivEXT, PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetConvolutionParameterxvOES, PFNGLGETCONVOLUTIONPARAMETERXVOESPROC, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetCoverageModulationTableNV, PFNGLGETCOVERAGEMODULATIONTABLENVPROC, (GLsizei bufSize, GLfloat *v), (bufSize, v))
+GLAD_FUNC(GLuint, glGetDebugMessageLog, PFNGLGETDEBUGMESSAGELOGPROC, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GLAD_FUNC(GLuint, glGetDebugMessageLogAMD, PFNGLGETDEBUGMESSAGELOGAMDPROC, (GLuint count, GLsizei bufSize, GLenum *categories, GLenum *severities, GLuint *ids, GLsizei *lengths, GLchar *message), (count, bufSize, categories, severities, ids, lengths, message))
+GLAD_FUNC(GLuint, glGetDebugMessageLogARB, PFNGLGETDEBUGMESSAGELOGARBPROC, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GLAD_FUNC(GLuint, glGetDebugMessageLogKHR, PFNGLGETDEBUGMESSAGELOGKHRPROC, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GLAD_FUNC_VOID(glGetDetailTexFuncSGIS, PFNGLGETDETAILTEXFUNCSGISPROC, (GLenum target, GLfloat *points), (target, points))
+GLAD_FUNC_VOID(glGetDoubleIndexedvEXT, PFNGLGETDOUBLEINDEXEDVEXTPROC, (GLenum target, GLuint index, GLdouble *data), (target, index, data))
+GLAD_FUNC_VOID(glGetDoublei_v, PFNGLGETDOUBLEI_VPROC, (GLenum target, GLuint index, GLdouble *data), (target, index, data))
+GLAD_FUNC_VOID(glGetDoublei_vEXT, PFNGLGETDOUBLEI_VEXTPROC, (GLenum pname, GLuint index, GLdouble *params), (pname, index, params))
+GLAD_FUNC_VOID(glGetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data))
+GLAD_FUNC(GLenum, glGetError, PFNGLGETERRORPROC, (void), ())
+GLAD_FUNC_VOID(glGetFenceivNV, PFNGLGETFENCEIVNVPROC, (GLuint fence, GLenum pname, GLint *params), (fence, pname, params))
+GLAD_FUNC_VOID(glGetFinalCombinerInputParameterfvNV, PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC, (GLenum variable, GLenum pname, GLfloat *params), (variable, pname, params))
+GLAD_FUNC_VOID(glGetFinalCombinerInputParameterivNV, PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC, (GLenum variable, GLenum pname, GLint *params), (variable, pname, params))
+GLAD_FUNC_VOID(glGetFirstPerfQueryIdINTEL, PFNGLGETFIRSTPERFQUERYIDINTELPROC, (GLuint *queryId), (queryId))
+GLAD_FUNC_VOID(glGetFixedvOES, PFNGLGETFIXEDVOESPROC, (GLenum pname, GLfixed *params), (pname, params))
+GLAD_FUNC_VOID(glGetFloatIndexedvEXT, PFNGLGETFLOATINDEXEDVEXTPROC, (GLenum target, GLuint index, GLfloat *data), (target, index, data))
+GLAD_FUNC_VOID(glGetFloati_v, PFNGLGETFLOATI_VPROC, (GLenum target, GLuint index, GLfloat *data), (target, index, data))
+GLAD_FUNC_VOID(glGetFloati_vEXT, PFNGLGETFLOATI_VEXTPROC, (GLenum pname, GLuint index, GLfloat *params), (pname, index, params))
+GLAD_FUNC_VOID(glGetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data))
+GLAD_FUNC_VOID(glGetFogFuncSGIS, PFNGLGETFOGFUNCSGISPROC, (GLfloat *points), (points))
+GLAD_FUNC(GLint, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_FUNC(GLint, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_FUNC(GLint, glGetFragDataLocationEXT, PFNGLGETFRAGDATALOCATIONEXTPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_FUNC_VOID(glGetFragmentLightfvSGIX, PFNGLGETFRAGMENTLIGHTFVSGIXPROC, (GLenum light, GLenum pname, GLfloat *params), (light, pname, params))
+GLAD_FUNC_VOID(glGetFragmentLightivSGIX, PFNGLGETFRAGMENTLIGHTIVSGIXPROC, (GLenum light, GLenum pname, GLint *params), (light, pname, params))
+GLAD_FUNC_VOID(glGetFragmentMaterialfvSGIX, PFNGLGETFRAGMENTMATERIALFVSGIXPROC, (GLenum face, GLenum pname, GLfloat *params), (face, pname, params))
+GLAD_FUNC_VOID(glGetFragmentMaterialivSGIX, PFNGLGETFRAGMENTMATERIALIVSGIXPROC, (GLenum face, GLenum pname, GLint *params), (face, pname, params))
+GLAD_FUNC_VOID(glGetFragmentShadingRatesEXT, PFNGLGETFRAGMENTSHADINGRATESEXTPROC, (GLsizei samples, GLsizei maxCount, GLsizei *count, GLenum *shadingRates), (samples, maxCount, count, shadingRates))
+GLAD_FUNC_VOID(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_FUNC_VOID(glGetFramebufferAttachmentParameterivEXT, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_FUNC_VOID(glGetFramebufferParameterfvAMD, PFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC, (GLenum target, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat *values), (target, pname, numsamples, pixelindex, size, values))
+GLAD_FUNC_VOID(glGetFramebufferParameteriv, PFNGLGETFRAMEBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetFramebufferParameterivEXT, PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC, (GLuint framebuffer, GLenum pname, GLint *params), (framebuffer, pname, params))
+GLAD_FUNC_VOID(glGetFramebufferParameterivMESA, PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC(GLenum, glGetGraphicsResetStatus, PFNGLGETGRAPHICSRESETSTATUSPROC, (void), ())
+GLAD_FUNC(GLenum, glGetGraphicsResetStatusARB, PFNGLGETGRAPHICSRESETSTATUSARBPROC, (void), ())
+GLAD_FUNC(GLenum, glGetGraphicsResetStatusKHR, PFNGLGETGRAPHICSRESETSTATUSKHRPROC, (void), ())
+GLAD_FUNC(GLhandleARB, glGetHandleARB, PFNGLGETHANDLEARBPROC, (GLenum pname), (pname))
+GLAD_FUNC_VOID(glGetHistogram, PFNGLGETHISTOGRAMPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values))
+GLAD_FUNC_VOID(glGetHistogramEXT, PFNGLGETHISTOGRAMEXTPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values))
+GLAD_FUNC_VOID(glGetHistogramParameterfv, PFNGLGETHISTOGRAMPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetHistogramParameterfvEXT, PFNGLGETHISTOGRAMPARAMETERFVEXTPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetHistogramParameteriv, PFNGLGETHISTOGRAMPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetHistogramParameterivEXT, PFNGLGETHISTOGRAMPARAMETERIVEXTPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetHistogramParameterxvOES, PFNGLGETHISTOGRAMPARAMETERXVOESPROC, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params))
+GLAD_FUNC(GLuint64, glGetImageHandleARB, PFNGLGETIMAGEHANDLEARBPROC, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format), (texture, level, layered, layer, format))
+GLAD_FUNC(GLuint64, glGetImageHandleNV, PFNGLGETIMAGEHANDLENVPROC, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format), (texture, level, layered, layer, format))
+GLAD_FUNC_VOID(glGetImageTransformParameterfvHP, PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetImageTransformParameterivHP, PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetInfoLogARB, PFNGLGETINFOLOGARBPROC, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog), (obj, maxLength, length, infoLog))
+GLAD_FUNC(GLint, glGetInstrumentsSGIX, PFNGLGETINSTRUMENTSSGIXPROC, (void), ())
+GLAD_FUNC_VOID(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GLAD_FUNC_VOID(glGetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data))
+GLAD_FUNC_VOID(glGetIntegerIndexedvEXT, PFNGLGETINTEGERINDEXEDVEXTPROC, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_FUNC_VOID(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_FUNC_VOID(glGetIntegerui64i_vNV, PFNGLGETINTEGERUI64I_VNVPROC, (GLenum value, GLuint index, GLuint64EXT *result), (value, index, result))
+GLAD_FUNC_VOID(glGetIntegerui64vNV, PFNGLGETINTEGERUI64VNVPROC, (GLenum value, GLuint64EXT *result), (value, result))
+GLAD_FUNC_VOID(glGetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data))
+GLAD_FUNC_VOID(glGetInternalformatSampleivNV, PFNGLGETINTERNALFORMATSAMPLEIVNVPROC, (GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei count, GLint *params), (target, internalformat, samples, pname, count, params))
+GLAD_FUNC_VOID(glGetInternalformati64v, PFNGLGETINTERNALFORMATI64VPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params), (target, internalformat, pname, count, params))
+GLAD_FUNC_VOID(glGetInternalformativ, PFNGLGETINTERNALFORMATIVPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params), (target, internalformat, pname, count, params))
+GLAD_FUNC_VOID(glGetInvariantBooleanvEXT, PFNGLGETINVARIANTBOOLEANVEXTPROC, (GLuint id, GLenum value, GLboolean *data), (id, value, data))
+GLAD_FUNC_VOID(glGetInvariantFloatvEXT, PFNGLGETINVARIANTFLOATVEXTPROC, (GLuint id, GLenum value, GLfloat *data), (id, value, data))
+GLAD_FUNC_VOID(glGetInvariantIntegervEXT, PFNGLGETINVARIANTINTEGERVEXTPROC, (GLuint id, GLenum value, GLint *data), (id, value, data))
+GLAD_FUNC_VOID(glGetLightxOES, PFNGLGETLIGHTXOESPROC, (GLenum light, GLenum pname, GLfixed *params), (light, pname, params))
+GLAD_FUNC_VOID(glGetLightxvOES, PFNGLGETLIGHTXVOESPROC, (GLenum light, GLenum pname, GLfixed *params), (light, pname, params))
+GLAD_FUNC_VOID(glGetListParameterfvSGIX, PFNGLGETLISTPARAMETERFVSGIXPROC, (GLuint list, GLenum pname, GLfloat *params), (list, pname, params))
+GLAD_FUNC_VOID(glGetListParameterivSGIX, PFNGLGETLISTPARAMETERIVSGIXPROC, (GLuint list, GLenum pname, GLint *params), (list, pname, params))
+GLAD_FUNC_VOID(glGetLocalConstantBooleanvEXT, PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC, (GLuint id, GLenum value, GLboolean *data), (id, value, data))
+GLAD_FUNC_VOID(glGetLocalConstantFloatvEXT, PFNGLGETLOCALCONSTANTFLOATVEXTPROC, (GLuint id, GLenum value, GLfloat *data), (id, value, data))
+GLAD_FUNC_VOID(glGetLocalConstantIntegervEXT, PFNGLGETLOCALCONSTANTINTEGERVEXTPROC, (GLuint id, GLenum value, GLint *data), (id, value, data))
+GLAD_FUNC_VOID(glGetMapAttribParameterfvNV, PFNGLGETMAPATTRIBPARAMETERFVNVPROC, (GLenum target, GLuint index, GLenum pname, GLfloat *params), (target, index, pname, params))
+GLAD_FUNC_VOID(glGetMapAttribParameterivNV, PFNGLGETMAPATTRIBPARAMETERIVNVPROC, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params))
+GLAD_FUNC_VOID(glGetMapControlPointsNV, PFNGLGETMAPCONTROLPOINTSNVPROC, (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, void *points), (target, index, type, ustride, vstride, packed, points))
+GLAD_FUNC_VOID(glGetMapParameterfvNV, PFNGLGETMAPPARAMETERFVNVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetMapParameterivNV, PFNGLGETMAPPARAMETERIVNVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetMapxvOES, PFNGLGETMAPXVOESPROC, (GLenum target, GLenum query, GLfixed *v), (target, query, v))
+GLAD_FUNC_VOID(glGetMaterialxOES, PFNGLGETMATERIALXOESPROC, (GLenum face, GLenum pname, GLfixed param), (face, pname, param))
+GLAD_FUNC_VOID(glGetMaterialxvOES, PFNGLGETMATERIALXVOESPROC, (GLenum face, GLenum pname, GLfixed *params), (face, pname, params))
+GLAD_FUNC_VOID(glGetMemoryObjectDetachedResourcesuivNV, PFNGLGETMEMORYOBJECTDETACHEDRESOURCESUIVNVPROC, (GLuint memory, GLenum pname, GLint first, GLsizei count, GLuint *params), (memory, pname, first, count, params))
+GLAD_FUNC_VOID(glGetMemoryObjectParameterivEXT, PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC, (GLuint memoryObject, GLenum pname, GLint *params), (memoryObject, pname, params))
+GLAD_FUNC_VOID(glGetMinmax, PFNGLGETMINMAXPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values))
+GLAD_FUNC_VOID(glGetMinmaxEXT, PFNGLGETMINMAXEXTPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values))
+GLAD_FUNC_VOID(glGetMinmaxParameterfv, PFNGLGETMINMAXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetMinmaxParameterfvEXT, PFNGLGETMINMAXPARAMETERFVEXTPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetMinmaxParameteriv, PFNGLGETMINMAXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetMinmaxParameterivEXT, PFNGLGETMINMAXPARAMETERIVEXTPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexEnvfvEXT, PFNGLGETMULTITEXENVFVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLfloat *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexEnvivEXT, PFNGLGETMULTITEXENVIVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexGendvEXT, PFNGLGETMULTITEXGENDVEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, GLdouble *params), (texunit, coord, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexGenfvEXT, PFNGLGETMULTITEXGENFVEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, GLfloat *params), (texunit, coord, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexGenivEXT, PFNGLGETMULTITEXGENIVEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, GLint *params), (texunit, coord, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexImageEXT, PFNGLGETMULTITEXIMAGEEXTPROC, (GLenum texunit, GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (texunit, target, level, format, type, pixels))
+GLAD_FUNC_VOID(glGetMultiTexLevelParameterfvEXT, PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC, (GLenum texunit, GLenum target, GLint level, GLenum pname, GLfloat *params), (texunit, target, level, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexLevelParameterivEXT, PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC, (GLenum texunit, GLenum target, GLint level, GLenum pname, GLint *params), (texunit, target, level, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexParameterIivEXT, PFNGLGETMULTITEXPARAMETERIIVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexParameterIuivEXT, PFNGLGETMULTITEXPARAMETERIUIVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLuint *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexParameterfvEXT, PFNGLGETMULTITEXPARAMETERFVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLfloat *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glGetMultiTexParameterivEXT, PFNGLGETMULTITEXPARAMETERIVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_FUNC_VOID(glGetMultisamplefvNV, PFNGLGETMULTISAMPLEFVNVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_FUNC_VOID(glGetNamedBufferParameteri64v, PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, (GLuint buffer, GLenum pname, GLint64 *params), (buffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedBufferParameteriv, PFNGLGETNAMEDBUFFERPARAMETERIVPROC, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedBufferParameterivEXT, PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedBufferParameterui64vNV, PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC, (GLuint buffer, GLenum pname, GLuint64EXT *params), (buffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedBufferPointerv, PFNGLGETNAMEDBUFFERPOINTERVPROC, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedBufferPointervEXT, PFNGLGETNAMEDBUFFERPOINTERVEXTPROC, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedBufferSubData, PFNGLGETNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data))
+GLAD_FUNC_VOID(glGetNamedBufferSubDataEXT, PFNGLGETNAMEDBUFFERSUBDATAEXTPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data))
+GLAD_FUNC_VOID(glGetNamedFramebufferAttachmentParameteriv, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params))
+GLAD_FUNC_VOID(glGetNamedFramebufferAttachmentParameterivEXT, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params))
+GLAD_FUNC_VOID(glGetNamedFramebufferParameterfvAMD, PFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC, (GLuint framebuffer, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat *values), (framebuffer, pname, numsamples, pixelindex, size, values))
+GLAD_FUNC_VOID(glGetNamedFramebufferParameteriv, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, (GLuint framebuffer, GLenum pname, GLint *param), (framebuffer, pname, param))
+GLAD_FUNC_VOID(glGetNamedFramebufferParameterivEXT, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC, (GLuint framebuffer, GLenum pname, GLint *params), (framebuffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedProgramLocalParameterIivEXT, PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC, (GLuint program, GLenum target, GLuint index, GLint *params), (program, target, index, params))
+GLAD_FUNC_VOID(glGetNamedProgramLocalParameterIuivEXT, PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC, (GLuint program, GLenum target, GLuint index, GLuint *params), (program, target, index, params))
+GLAD_FUNC_VOID(glGetNamedProgramLocalParameterdvEXT, PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC, (GLuint program, GLenum target, GLuint index, GLdouble *params), (program, target, index, params))
+GLAD_FUNC_VOID(glGetNamedProgramLocalParameterfvEXT, PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC, (GLuint program, GLenum target, GLuint index, GLfloat *params), (program, target, index, params))
+GLAD_FUNC_VOID(glGetNamedProgramStringEXT, PFNGLGETNAMEDPROGRAMSTRINGEXTPROC, (GLuint program, GLenum target, GLenum pname, void *string), (program, target, pname, string))
+GLAD_FUNC_VOID(glGetNamedProgramivEXT, PFNGLGETNAMEDPROGRAMIVEXTPROC, (GLuint program, GLenum target, GLenum pname, GLint *params), (program, target, pname, params))
+GLAD_FUNC_VOID(glGetNamedRenderbufferParameteriv, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedRenderbufferParameterivEXT, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params))
+GLAD_FUNC_VOID(glGetNamedStringARB, PFNGLGETNAMEDSTRINGARBPROC, (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string), (namelen, name, bufSize, stringlen, string))
+GLAD_FUNC_VOID(glGetNamedStringivARB, PFNGLGETNAMEDSTRINGIVARBPROC, (GLint namelen, const GLchar *name, GLenum pname, GLint *params), (namelen, name, pname, params))
+GLAD_FUNC_VOID(glGetNextPerfQueryIdINTEL, PFNGLGETNEXTPERFQUERYIDINTELPROC, (GLuint queryId, GLuint *nextQueryId), (queryId, nextQueryId))
+GLAD_FUNC_VOID(glGetObjectBufferfvATI, PFNGLGETOBJECTBUFFERFVATIPROC, (GLuint buffer, GLenum pname, GLfloat *params), (buffer, pname, params))
+GLAD_FUNC_VOID(glGetObjectBufferivATI, PFNGLGETOBJECTBUFFERIVATIPROC, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GLAD_FUNC_VOID(glGetObjectLabel, PFNGLGETOBJECTLABELPROC, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label))
+GLAD_FUNC_VOID(glGetObjectLabelEXT, PFNGLGETOBJECTLABELEXTPROC, (GLenum type, GLuint object, GLsizei bufSize, GLsizei *length, GLchar *label), (type, object, bufSize, length, label))
+GLAD_FUNC_VOID(glGetObjectLabelKHR, PFNGLGETOBJECTLABELKHRPROC, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label))
+GLAD_FUNC_VOID(glGetObjectParameterfvARB, PFNGLGETOBJECTPARAMETERFVARBPROC, (GLhandleARB obj, GLenum pname, GLfloat *params), (obj, pname, params))
+GLAD_FUNC_VOID(glGetObjectParameterivAPPLE, PFNGLGETOBJECTPARAMETERIVAPPLEPROC, (GLenum objectType, GLuint name, GLenum pname, GLint *params), (objectType, name, pname, params))
+GLAD_FUNC_VOID(glGetObjectParameterivARB, PFNGLGETOBJECTPARAMETERIVARBPROC, (GLhandleARB obj, GLenum pname, GLint *params), (obj, pname, params))
+GLAD_FUNC_VOID(glGetObjectPtrLabel, PFNGLGETOBJECTPTRLABELPROC, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label))
+GLAD_FUNC_VOID(glGetObjectPtrLabelKHR, PFNGLGETOBJECTPTRLABELKHRPROC, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label))
+GLAD_FUNC_VOID(glGetOcclusionQueryivNV, PFNGLGETOCCLUSIONQUERYIVNVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetOcclusionQueryuivNV, PFNGLGETOCCLUSIONQUERYUIVNVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetPathColorGenfvNV, PFNGLGETPATHCOLORGENFVNVPROC, (GLenum color, GLenum pname, GLfloat *value), (color, pname, value))
+GLAD_FUNC_VOID(glGetPathColorGenivNV, PFNGLGETPATHCOLORGENIVNVPROC, (GLenum color, GLenum pname, GLint *value), (color, pname, value))
+GLAD_FUNC_VOID(glGetPathCommandsNV, PFNGLGETPATHCOMMANDSNVPROC, (GLuint path, GLubyte *commands), (path, commands))
+GLAD_FUNC_VOID(glGetPathCoordsNV, PFNGLGETPATHCOORDSNVPROC, (GLuint path, GLfloat *coords), (path, coords))
+GLAD_FUNC_VOID(glGetPathDashArrayNV, PFNGLGETPATHDASHARRAYNVPROC, (GLuint path, GLfloat *dashArray), (path, dashArray))
+GLAD_FUNC(GLfloat, glGetPathLengthNV, PFNGLGETPATHLENGTHNVPROC, (GLuint path, GLsizei startSegment, GLsizei numSegments), (path, startSegment, numSegments))
+GLAD_FUNC_VOID(glGetPathMetricRangeNV, PFNGLGETPATHMETRICRANGENVPROC, (GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat *metrics), (metricQueryMask, firstPathName, numPaths, stride, metrics))
+GLAD_FUNC_VOID(glGetPathMetricsNV, PFNGLGETPATHMETRICSNVPROC, (GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics), (metricQueryMask, numPaths, pathNameType, paths, pathBase, stride, metrics))
+GLAD_FUNC_VOID(glGetPathParameterfvNV, PFNGLGETPATHPARAMETERFVNVPROC, (GLuint path, GLenum pname, GLfloat *value), (path, pname, value))
+GLAD_FUNC_VOID(glGetPathParameterivNV, PFNGLGETPATHPARAMETERIVNVPROC, (GLuint path, GLenum pname, GLint *value), (path, pname, value))
+GLAD_FUNC_VOID(glGetPathSpacingNV, PFNGLGETPATHSPACINGNVPROC, (GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing), (pathListMode, numPaths, pathNameType, paths, pathBase, advanceScale, kerningScale, transformType, returnedSpacing))
+GLAD_FUNC_VOID(glGetPathTexGenfvNV, PFNGLGETPATHTEXGENFVNVPROC, (GLenum texCoordSet, GLenum pname, GLfloat *value), (texCoordSet, pname, value))
+GLAD_FUNC_VOID(glGetPathTexGenivNV, PFNGLGETPATHTEXGENIVNVPROC, (GLenum texCoordSet, GLenum pname, GLint *value), (texCoordSet, pname, value))
+GLAD_FUNC_VOID(glGetPerfCounterInfoINTEL, PFNGLGETPERFCOUNTERINFOINTELPROC, (GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue), (queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue))
+GLAD_FUNC_VOID(glGetPerfMonitorCounterDataAMD, PFNGLGETPERFMONITORCOUNTERDATAAMDPROC, (GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten), (monitor, pname, dataSize, data, bytesWritten))
+GLAD_FUNC_VOID(glGetPerfMonitorCounterInfoAMD, PFNGLGETPERFMONITORCOUNTERINFOAMDPROC, (GLuint group, GLuint counter, GLenum pname, void *data), (group, counter, pname, data))
+GLAD_FUNC_VOID(glGetPerfMonitorCounterStringAMD, PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC, (GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString), (group, counter, bufSize, length, counterString))
+GLAD_FUNC_VOID(glGetPerfMonitorCountersAMD, PFNGLGETPERFMONITORCOUNTERSAMDPROC, (GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei counterSize, GLuint *counters), (group, numCounters, maxActiveCounters, counterSize, counters))
+GLAD_FUNC_VOID(glGetPerfMonitorGroupStringAMD, PFNGLGETPERFMONITORGROUPSTRINGAMDPROC, (GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString), (group, bufSize, length, groupString))
+GLAD_FUNC_VOID(glGetPerfMonitorGroupsAMD, PFNGLGETPERFMONITORGROUPSAMDPROC, (GLint *numGroups, GLsizei groupsSize, GLuint *groups), (numGroups, groupsSize, groups))
+GLAD_FUNC_VOID(glGetPerfQueryDataINTEL, PFNGLGETPERFQUERYDATAINTELPROC, (GLuint queryHandle, GLuint flags, GLsizei dataSize, void *data, GLuint *bytesWritten), (queryHandle, flags, dataSize, data, bytesWritten))
+GLAD_FUNC_VOID(glGetPerfQueryIdByNameINTEL, PFNGLGETPERFQUERYIDBYNAMEINTELPROC, (GLchar *queryName, GLuint *queryId), (queryName, queryId))
+GLAD_FUNC_VOID(glGetPerfQueryInfoINTEL, PFNGLGETPERFQUERYINFOINTELPROC, (GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask), (queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask))
+GLAD_FUNC_VOID(glGetPixelMapxv, PFNGLGETPIXELMAPXVPROC, (GLenum map, GLint size, GLfixed *values), (map, size, values))
+GLAD_FUNC_VOID(glGetPixelTexGenParameterfvSGIS, PFNGLGETPIXELTEXGENPARAMETERFVSGISPROC, (GLenum pname, GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glGetPixelTexGenParameterivSGIS, PFNGLGETPIXELTEXGENPARAMETERIVSGISPROC, (GLenum pname, GLint *params), (pname, params))
+GLAD_FUNC_VOID(glGetPixelTransformParameterfvEXT, PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetPixelTransformParameterivEXT, PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetPointerIndexedvEXT, PFNGLGETPOINTERINDEXEDVEXTPROC, (GLenum target, GLuint index, void **data), (target, index, data))
+GLAD_FUNC_VOID(glGetPointeri_vEXT, PFNGLGETPOINTERI_VEXTPROC, (GLenum pname, GLuint index, void **params), (pname, index, params))
+GLAD_FUNC_VOID(glGetPointerv, PFNGLGETPOINTERVPROC, (GLenum pname, void **params), (pname, params))
+GLAD_FUNC_VOID(glGetPointervEXT, PFNGLGETPOINTERVEXTPROC, (GLenum pname, void **params), (pname, params))
+GLAD_FUNC_VOID(glGetPointervKHR, PFNGLGETPOINTERVKHRPROC, (GLenum pname, void **params), (pname, params))
+GLAD_FUNC_VOID(glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GLAD_FUNC_VOID(glGetProgramEnvParameterIivNV, PFNGLGETPROGRAMENVPARAMETERIIVNVPROC, (GLenum target, GLuint index, GLint *params), (target, index, params))
+GLAD_FUNC_VOID(glGetProgramEnvParameterIuivNV, PFNGLGETPROGRAMENVPARAMETERIUIVNVPROC, (GLenum target, GLuint index, GLuint *params), (target, index, params))
+GLAD_FUNC_VOID(glGetProgramEnvParameterdvARB, PFNGLGETPROGRAMENVPARAMETERDVARBPROC, (GLenum target, GLuint index, GLdouble *params), (target, index, params))
+GLAD_FUNC_VOID(glGetProgramEnvParameterfvARB, PFNGLGETPROGRAMENVPARAMETERFVARBPROC, (GLenum target, GLuint index, GLfloat *params), (target, index, params))
+GLAD_FUNC_VOID(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GLAD_FUNC_VOID(glGetProgramInterfaceiv, PFNGLGETPROGRAMINTERFACEIVPROC, (GLuint program, GLenum programInterface, GLenum pname, GLint *params), (program, programInterface, pname, params))
+GLAD_FUNC_VOID(glGetProgramLocalParameterIivNV, PFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC, (GLenum target, GLuint index, GLint *params), (target, index, params))
+GLAD_FUNC_VOID(glGetProgramLocalParameterIuivNV, PFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC, (GLenum target, GLuint index, GLuint *params), (target, index, params))
+GLAD_FUNC_VOID(glGetProgramLocalParameterdvARB, PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC, (GLenum target, GLuint index, GLdouble *params), (target, index, params))
+GLAD_FUNC_VOID(glGetProgramLocalParameterfvARB, PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC, (GLenum target, GLuint index, GLfloat *params), (target, index, params))
+GLAD_FUNC_VOID(glGetProgramNamedParameterdvNV, PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC, (GLuint id, GLsizei len, const GLubyte *name, GLdouble *params), (id, len, name, params))
+GLAD_FUNC_VOID(glGetProgramNamedParameterfvNV, PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC, (GLuint id, GLsizei len, const GLubyte *name, GLfloat *params), (id, len, name, params))
+GLAD_FUNC_VOID(glGetProgramParameterdvNV, PFNGLGETPROGRAMPARAMETERDVNVPROC, (GLenum target, GLuint index, GLenum pname, GLdouble *params), (target, index, pname, params))
+GLAD_FUNC_VOID(glGetProgramParameterfvNV, PFNGLGETPROGRAMPARAMETERFVNVPROC, (GLenum target, GLuint index, GLenum pname, GLfloat *params), (target, index, pname, params))
+GLAD_FUNC_VOID(glGetProgramPipelineInfoLog, PFNGLGETPROGRAMPIPELINEINFOLOGPROC, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog))
+GLAD_FUNC_VOID(glGetProgramPipelineInfoLogEXT, PFNGLGETPROGRAMPIPELINEINFOLOGEXTPROC, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog))
+GLAD_FUNC_VOID(glGetProgramPipelineiv, PFNGLGETPROGRAMPIPELINEIVPROC, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params))
+GLAD_FUNC_VOID(glGetProgramPipelineivEXT, PFNGLGETPROGRAMPIPELINEIVEXTPROC, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params))
+GLAD_FUNC(GLuint, glGetProgramResourceIndex, PFNGLGETPROGRAMRESOURCEINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_FUNC(GLint, glGetProgramResourceLocation, PFNGLGETPROGRAMRESOURCELOCATIONPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_FUNC(GLint, glGetProgramResourceLocationIndex, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_FUNC_VOID(glGetProgramResourceName, PFNGLGETPROGRAMRESOURCENAMEPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, programInterface, index, bufSize, length, name))
+GLAD_FUNC_VOID(glGetProgramResourcefvNV, PFNGLGETPROGRAMRESOURCEFVNVPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLfloat *params), (program, programInterface, index, propCount, props, count, length, params))
+GLAD_FUNC_VOID(glGetProgramResourceiv, PFNGLGETPROGRAMRESOURCEIVPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params), (program, programInterface, index, propCount, props, count, length, params))
+GLAD_FUNC_VOID(glGetProgramStageiv, PFNGLGETPROGRAMSTAGEIVPROC, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values))
+GLAD_FUNC_VOID(glGetProgramStringARB, PFNGLGETPROGRAMSTRINGARBPROC, (GLenum target, GLenum pname, void *string), (target, pname, string))
+GLAD_FUNC_VOID(glGetProgramStringNV, PFNGLGETPROGRAMSTRINGNVPROC, (GLuint id, GLenum pname, GLubyte *program), (id, pname, program))
+GLAD_FUNC_VOID(glGetProgramSubroutineParameteruivNV, PFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC, (GLenum target, GLuint index, GLuint *param), (target, index, param))
+GLAD_FUNC_VOID(glGetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GLAD_FUNC_VOID(glGetProgramivARB, PFNGLGETPROGRAMIVARBPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetProgramivNV, PFNGLGETPROGRAMIVNVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryBufferObjecti64v, PFNGLGETQUERYBUFFEROBJECTI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_FUNC_VOID(glGetQueryBufferObjectiv, PFNGLGETQUERYBUFFEROBJECTIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_FUNC_VOID(glGetQueryBufferObjectui64v, PFNGLGETQUERYBUFFEROBJECTUI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_FUNC_VOID(glGetQueryBufferObjectuiv, PFNGLGETQUERYBUFFEROBJECTUIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_FUNC_VOID(glGetQueryIndexediv, PFNGLGETQUERYINDEXEDIVPROC, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params))
+GLAD_FUNC_VOID(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryObjecti64vEXT, PFNGLGETQUERYOBJECTI64VEXTPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryObjectivARB, PFNGLGETQUERYOBJECTIVARBPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryObjectui64vEXT, PFNGLGETQUERYOBJECTUI64VEXTPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryObjectuivARB, PFNGLGETQUERYOBJECTUIVARBPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetQueryivARB, PFNGLGETQUERYIVARBPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetRenderbufferParameterivEXT, PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_FUNC_VOID(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GLAD_FUNC_VOID(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GLAD_FUNC_VOID(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_FUNC_VOID(glGetSemaphoreParameterivNV, PFNGLGETSEMAPHOREPARAMETERIVNVPROC, (GLuint semaphore, GLenum pname, GLint *params), (semaphore, pname, params))
+GLAD_FUNC_VOID(glGetSemaphoreParameterui64vEXT, PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC, (GLuint semaphore, GLenum pname, GLuint64 *params), (semaphore, pname, params))
+GLAD_FUNC_VOID(glGetSeparableFilter, PFNGLGETSEPARABLEFILTERPROC, (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span), (target, format, type, row, column, span))
+GLAD_FUNC_VOID(glGetSeparableFilterEXT, PFNGLGETSEPARABLEFILTEREXTPROC, (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span), (target, format, type, row, column, span))
+GLAD_FUNC_VOID(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GLAD_FUNC_VOID(glGetShaderPrecisionFormat, PFNGLGETSHADERPRECISIONFORMATPROC, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision))
+GLAD_FUNC_VOID(glGetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GLAD_FUNC_VOID(glGetShaderSourceARB, PFNGLGETSHADERSOURCEARBPROC, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *source), (obj, maxLength, length, source))
+GLAD_FUNC_VOID(glGetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GLAD_FUNC_VOID(glGetShadingRateImagePaletteNV, PFNGLGETSHADINGRATEIMAGEPALETTENVPROC, (GLuint viewport, GLuint entry, GLenum *rate), (viewport, entry, rate))
+GLAD_FUNC_VOID(glGetShadingRateSampleLocationivNV, PFNGLGETSHADINGRATESAMPLELOCATIONIVNVPROC, (GLenum rate, GLuint samples, GLuint index, GLint *location), (rate, samples, index, location))
+GLAD_FUNC_VOID(glGetSharpenTexFuncSGIS, PFNGLGETSHARPENTEXFUNCSGISPROC, (GLenum target, GLfloat *points), (target, points))
+GLAD_FUNC(GLushort, glGetStageIndexNV, PFNGLGETSTAGEINDEXNVPROC, (GLenum shadertype), (shadertype))
+GLAD_FUNC(const GLubyte *, glGetString, PFNGLGETSTRINGPROC, (GLenum name), (name))
+GLAD_FUNC(const GLubyte *, glGetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index))
+GLAD_FUNC(GLuint, glGetSubroutineIndex, PFNGLGETSUBROUTINEINDEXPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GLAD_FUNC(GLint, glGetSubroutineUniformLocation, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GLAD_FUNC_VOID(glGetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GLAD_FUNC_VOID(glGetTexBumpParameterfvATI, PFNGLGETTEXBUMPPARAMETERFVATIPROC, (GLenum pname, GLfloat *param), (pname, param))
+GLAD_FUNC_VOID(glGetTexBumpParameterivATI, PFNGLGETTEXBUMPPARAMETERIVATIPROC, (GLenum pname, GLint *param), (pname, param))
+GLAD_FUNC_VOID(glGetTexEnvxvOES, PFNGLGETTEXENVXVOESPROC, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetTexFilterFuncSGIS, PFNGLGETTEXFILTERFUNCSGISPROC, (GLenum target, GLenum filter, GLfloat *weights), (target, filter, weights))
+GLAD_FUNC_VOID(glGetTexGenxvOES, PFNGLGETTEXGENXVOESPROC, (GLenum coord, GLenum pname, GLfixed *params), (coord, pname, params))
+GLAD_FUNC_VOID(glGetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GLAD_FUNC_VOID(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GLAD_FUNC_VOID(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GLAD_FUNC_VOID(glGetTexLevelParameterxvOES, PFNGLGETTEXLEVELPARAMETERXVOESPROC, (GLenum target, GLint level, GLenum pname, GLfixed *params), (target, level, pname, params))
+GLAD_FUNC_VOID(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetTexParameterIivEXT, PFNGLGETTEXPARAMETERIIVEXTPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetTexParameterIuivEXT, PFNGLGETTEXPARAMETERIUIVEXTPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetTexParameterPointervAPPLE, PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_FUNC_VOID(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glGetTexParameterxvOES, PFNGLGETTEXPARAMETERXVOESPROC, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params))
+GLAD_FUNC(GLuint64, glGetTextureHandleARB, PFNGLGETTEXTUREHANDLEARBPROC, (GLuint texture), (texture))
+GLAD_FUNC(GLuint64, glGetTextureHandleNV, PFNGLGETTEXTUREHANDLENVPROC, (GLuint texture), (texture))
+GLAD_FUNC_VOID(glGetTextureImage, PFNGLGETTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, format, type, bufSize, pixels))
+GLAD_FUNC_VOID(glGetTextureImageEXT, PFNGLGETTEXTUREIMAGEEXTPROC, (GLuint texture, GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (texture, target, level, format, type, pixels))
+GLAD_FUNC_VOID(glGetTextureLevelParameterfv, PFNGLGETTEXTURELEVELPARAMETERFVPROC, (GLuint texture, GLint level, GLenum pname, GLfloat *params), (texture, level, pname, params))
+GLAD_FUNC_VOID(glGetTextureLevelParameterfvEXT, PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC, (GLuint texture, GLenum target, GLint level, GLenum pname, GLfloat *params), (texture, target, level, pname, params))
+GLAD_FUNC_VOID(glGetTextureLevelParameteriv, PFNGLGETTEXTURELEVELPARAMETERIVPROC, (GLuint texture, GLint level, GLenum pname, GLint *params), (texture, level, pname, params))
+GLAD_FUNC_VOID(glGetTextureLevelParameterivEXT, PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC, (GLuint texture, GLenum target, GLint level, GLenum pname, GLint *params), (texture, target, level, pname, params))
+GLAD_FUNC_VOID(glGetTextureParameterIiv, PFNGLGETTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GLAD_FUNC_VOID(glGetTextureParameterIivEXT, PFNGLGETTEXTUREPARAMETERIIVEXTPROC, (GLuint texture, GLenum target, GLenum pname, GLint *params), (texture, target, pname, params))
+GLAD_FUNC_VOID(glGetTextureParameterIuiv, PFNGLGETTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, GLuint *params), (texture, pname, params))
+GLAD_FUNC_VOID(glGetTextureParameterIuivEXT, PFNGLGETTEXTUREPARAMETERIUIVEXTPROC, (GLuint texture, GLenum target, GLenum pname, GLuint *params), (texture, target, pname, params))
+GLAD_FUNC_VOID(glGetTextureParameterfv, PFNGLGETTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, GLfloat *params), (texture, pname, params))
+GLAD_FUNC_VOID(glGetTextureParameterfvEXT, PFNGLGETTEXTUREPARAMETERFVEXTPROC, (GLuint texture, GLenum target, GLenum pname, GLfloat *params), (texture, target, pname, params))
+GLAD_FUNC_VOID(glGetTextureParameteriv, PFNGLGETTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GLAD_FUNC_VOID(glGetTextureParameterivEXT, PFNGLGETTEXTUREPARAMETERIVEXTPROC, (GLuint texture, GLenum target, GLenum pname, GLint *params), (texture, target, pname, params))
+GLAD_FUNC(GLuint64, glGetTextureSamplerHandleARB, PFNGLGETTEXTURESAMPLERHANDLEARBPROC, (GLuint texture, GLuint sampler), (texture, sampler))
+GLAD_FUNC(GLuint64, glGetTextureSamplerHandleNV, PFNGLGETTEXTURESAMPLERHANDLENVPROC, (GLuint texture, GLuint sampler), (texture, sampler))
+GLAD_FUNC_VOID(glGetTextureSubImage, PFNGLGETTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels))
+GLAD_FUNC_VOID(glGetTrackMatrixivNV, PFNGLGETTRACKMATRIXIVNVPROC, (GLenum target, GLuint address, GLenum pname, GLint *params), (target, address, pname, params))
+GLAD_FUNC_VOID(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_FUNC_VOID(glGetTransformFeedbackVaryingEXT, PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_FUNC_VOID(glGetTransformFeedbackVaryingNV, PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC, (GLuint program, GLuint index, GLint *location), (program, index, location))
+GLAD_FUNC_VOID(glGetTransformFeedbacki64_v, PFNGLGETTRANSFORMFEEDBACKI64_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint64 *param), (xfb, pname, index, param))
+GLAD_FUNC_VOID(glGetTransformFeedbacki_v, PFNGLGETTRANSFORMFEEDBACKI_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint *param), (xfb, pname, index, param))
+GLAD_FUNC_VOID(glGetTransformFeedbackiv, PFNGLGETTRANSFORMFEEDBACKIVPROC, (GLuint xfb, GLenum pname, GLint *param), (xfb, pname, param))
+GLAD_FUNC(GLuint, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GLAD_FUNC(GLint, glGetUniformBufferSizeEXT, PFNGLGETUNIFORMBUFFERSIZEEXTPROC, (GLuint program, GLint location), (program, location))
+GLAD_FUNC_VOID(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GLAD_FUNC(GLint, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_FUNC(GLint, glGetUniformLocationARB, PFNGLGETUNIFORMLOCATIONARBPROC, (GLhandleARB programObj, const GLcharARB *name), (programObj, name))
+GLAD_FUNC(GLintptr, glGetUniformOffsetEXT, PFNGLGETUNIFORMOFFSETEXTPROC, (GLuint program, GLint location), (program, location))
+GLAD_FUNC_VOID(glGetUniformSubroutineuiv, PFNGLGETUNIFORMSUBROUTINEUIVPROC, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params))
+GLAD_FUNC_VOID(glGetUniformdv, PFNGLGETUNIFORMDVPROC, (GLuint program, GLint location, GLdouble *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUniformfvARB, PFNGLGETUNIFORMFVARBPROC, (GLhandleARB programObj, GLint location, GLfloat *params), (programObj, location, params))
+GLAD_FUNC_VOID(glGetUniformi64vARB, PFNGLGETUNIFORMI64VARBPROC, (GLuint program, GLint location, GLint64 *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUniformi64vNV, PFNGLGETUNIFORMI64VNVPROC, (GLuint program, GLint location, GLint64EXT *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUniformivARB, PFNGLGETUNIFORMIVARBPROC, (GLhandleARB programObj, GLint location, GLint *params), (programObj, location, params))
+GLAD_FUNC_VOID(glGetUniformui64vARB, PFNGLGETUNIFORMUI64VARBPROC, (GLuint program, GLint location, GLuint64 *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUniformui64vNV, PFNGLGETUNIFORMUI64VNVPROC, (GLuint program, GLint location, GLuint64EXT *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUniformuivEXT, PFNGLGETUNIFORMUIVEXTPROC, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_FUNC_VOID(glGetUnsignedBytei_vEXT, PFNGLGETUNSIGNEDBYTEI_VEXTPROC, (GLenum target, GLuint index, GLubyte *data), (target, index, data))
+GLAD_FUNC_VOID(glGetUnsignedBytevEXT, PFNGLGETUNSIGNEDBYTEVEXTPROC, (GLenum pname, GLubyte *data), (pname, data))
+GLAD_FUNC_VOID(glGetVariantArrayObjectfvATI, PFNGLGETVARIANTARRAYOBJECTFVATIPROC, (GLuint id, GLenum pname, GLfloat *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetVariantArrayObjectivATI, PFNGLGETVARIANTARRAYOBJECTIVATIPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_FUNC_VOID(glGetVariantBooleanvEXT, PFNGLGETVARIANTBOOLEANVEXTPROC, (GLuint id, GLenum value, GLboolean *data), (id, value, data))
+GLAD_FUNC_VOID(glGetVariantFloatvEXT, PFNGLGETVARIANTFLOATVEXTPROC, (GLuint id, GLenum value, GLfloat *data), (id, value, data))
+GLAD_FUNC_VOID(glGetVariantIntegervEXT, PFNGLGETVARIANTINTEGERVEXTPROC, (GLuint id, GLenum value, GLint *data), (id, value, data))
+GLAD_FUNC_VOID(glGetVariantPointervEXT, PFNGLGETVARIANTPOINTERVEXTPROC, (GLuint id, GLenum value, void **data), (id, value, data))
+GLAD_FUNC(GLint, glGetVaryingLocationNV, PFNGLGETVARYINGLOCATIONNVPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_FUNC_VOID(glGetVertexArrayIndexed64iv, PFNGLGETVERTEXARRAYINDEXED64IVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param), (vaobj, index, pname, param))
+GLAD_FUNC_VOID(glGetVertexArrayIndexediv, PFNGLGETVERTEXARRAYINDEXEDIVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param))
+GLAD_FUNC_VOID(glGetVertexArrayIntegeri_vEXT, PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param))
+GLAD_FUNC_VOID(glGetVertexArrayIntegervEXT, PFNGLGETVERTEXARRAYINTEGERVEXTPROC, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param))
+GLAD_FUNC_VOID(glGetVertexArrayPointeri_vEXT, PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC, (GLuint vaobj, GLuint index, GLenum pname, void **param), (vaobj, index, pname, param))
+GLAD_FUNC_VOID(glGetVertexArrayPointervEXT, PFNGLGETVERTEXARRAYPOINTERVEXTPROC, (GLuint vaobj, GLenum pname, void **param), (vaobj, pname, param))
+GLAD_FUNC_VOID(glGetVertexArrayiv, PFNGLGETVERTEXARRAYIVPROC, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param))
+GLAD_FUNC_VOID(glGetVertexAttribArrayObjectfvATI, PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribArrayObjectivATI, PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribIivEXT, PFNGLGETVERTEXATTRIBIIVEXTPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribIuivEXT, PFNGLGETVERTEXATTRIBIUIVEXTPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribLdv, PFNGLGETVERTEXATTRIBLDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribLdvEXT, PFNGLGETVERTEXATTRIBLDVEXTPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribLi64vNV, PFNGLGETVERTEXATTRIBLI64VNVPROC, (GLuint index, GLenum pname, GLint64EXT *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribLui64vARB, PFNGLGETVERTEXATTRIBLUI64VARBPROC, (GLuint index, GLenum pname, GLuint64EXT *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribLui64vNV, PFNGLGETVERTEXATTRIBLUI64VNVPROC, (GLuint index, GLenum pname, GLuint64EXT *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_FUNC_VOID(glGetVertexAttribPointervARB, PFNGLGETVERTEXATTRIBPOINTERVARBPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_FUNC_VOID(glGetVertexAttribPointervNV, PFNGLGETVERTEXATTRIBPOINTERVNVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_FUNC_VOID(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribdvARB, PFNGLGETVERTEXATTRIBDVARBPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribdvNV, PFNGLGETVERTEXATTRIBDVNVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribfvARB, PFNGLGETVERTEXATTRIBFVARBPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribfvNV, PFNGLGETVERTEXATTRIBFVNVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribivARB, PFNGLGETVERTEXATTRIBIVARBPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVertexAttribivNV, PFNGLGETVERTEXATTRIBIVNVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_FUNC_VOID(glGetVideoCaptureStreamdvNV, PFNGLGETVIDEOCAPTURESTREAMDVNVPROC, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLdouble *params), (video_capture_slot, stream, pname, params))
+GLAD_FUNC_VOID(glGetVideoCaptureStreamfvNV, PFNGLGETVIDEOCAPTURESTREAMFVNVPROC, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLfloat *params), (video_capture_slot, stream, pname, params))
+GLAD_FUNC_VOID(glGetVideoCaptureStreamivNV, PFNGLGETVIDEOCAPTURESTREAMIVNVPROC, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLint *params), (video_capture_slot, stream, pname, params))
+GLAD_FUNC_VOID(glGetVideoCaptureivNV, PFNGLGETVIDEOCAPTUREIVNVPROC, (GLuint video_capture_slot, GLenum pname, GLint *params), (video_capture_slot, pname, params))
+GLAD_FUNC_VOID(glGetVideoi64vNV, PFNGLGETVIDEOI64VNVPROC, (GLuint video_slot, GLenum pname, GLint64EXT *params), (video_slot, pname, params))
+GLAD_FUNC_VOID(glGetVideoivNV, PFNGLGETVIDEOIVNVPROC, (GLuint video_slot, GLenum pname, GLint *params), (video_slot, pname, params))
+GLAD_FUNC_VOID(glGetVideoui64vNV, PFNGLGETVIDEOUI64VNVPROC, (GLuint video_slot, GLenum pname, GLuint64EXT *params), (video_slot, pname, params))
+GLAD_FUNC_VOID(glGetVideouivNV, PFNGLGETVIDEOUIVNVPROC, (GLuint video_slot, GLenum pname, GLuint *params), (video_slot, pname, params))
+GLAD_FUNC(GLVULKANPROCNV, glGetVkProcAddrNV, PFNGLGETVKPROCADDRNVPROC, (const GLchar *name), (name))
+GLAD_FUNC_VOID(glGetnColorTableARB, PFNGLGETNCOLORTABLEARBPROC, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table))
+GLAD_FUNC_VOID(glGetnCompressedTexImageARB, PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC, (GLenum target, GLint lod, GLsizei bufSize, void *img), (target, lod, bufSize, img))
+GLAD_FUNC_VOID(glGetnConvolutionFilterARB, PFNGLGETNCONVOLUTIONFILTERARBPROC, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image))
+GLAD_FUNC_VOID(glGetnHistogramARB, PFNGLGETNHISTOGRAMARBPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GLAD_FUNC_VOID(glGetnMapdvARB, PFNGLGETNMAPDVARBPROC, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v))
+GLAD_FUNC_VOID(glGetnMapfvARB, PFNGLGETNMAPFVARBPROC, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v))
+GLAD_FUNC_VOID(glGetnMapivARB, PFNGLGETNMAPIVARBPROC, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v))
+GLAD_FUNC_VOID(glGetnMinmaxARB, PFNGLGETNMINMAXARBPROC, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GLAD_FUNC_VOID(glGetnPixelMapfvARB, PFNGLGETNPIXELMAPFVARBPROC, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values))
+GLAD_FUNC_VOID(glGetnPixelMapuivARB, PFNGLGETNPIXELMAPUIVARBPROC, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values))
+GLAD_FUNC_VOID(glGetnPixelMapusvARB, PFNGLGETNPIXELMAPUSVARBPROC, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values))
+GLAD_FUNC_VOID(glGetnPolygonStippleARB, PFNGLGETNPOLYGONSTIPPLEARBPROC, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern))
+GLAD_FUNC_VOID(glGetnSeparableFilterARB, PFNGLGETNSEPARABLEFILTERARBPROC, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span))
+GLAD_FUNC_VOID(glGetnTexImageARB, PFNGLGETNTEXIMAGEARBPROC, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img), (target, level, format, type, bufSize, img))
+GLAD_FUNC_VOID(glGetnUniformdvARB, PFNGLGETNUNIFORMDVARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformfv, PFNGLGETNUNIFORMFVPROC, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformfvARB, PFNGLGETNUNIFORMFVARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformfvKHR, PFNGLGETNUNIFORMFVKHRPROC, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformi64vARB, PFNGLGETNUNIFORMI64VARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLint64 *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformiv, PFNGLGETNUNIFORMIVPROC, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformivARB, PFNGLGETNUNIFORMIVARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformivKHR, PFNGLGETNUNIFORMIVKHRPROC, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformui64vARB, PFNGLGETNUNIFORMUI64VARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint64 *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformuiv, PFNGLGETNUNIFORMUIVPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformuivARB, PFNGLGETNUNIFORMUIVARBPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGetnUniformuivKHR, PFNGLGETNUNIFORMUIVKHRPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params))
+GLAD_FUNC_VOID(glGlobalAlphaFactorbSUN, PFNGLGLOBALALPHAFACTORBSUNPROC, (GLbyte factor), (factor))
+GLAD_FUNC_VOID(glGlobalAlphaFactordSUN, PFNGLGLOBALALPHAFACTORDSUNPROC, (GLdouble factor), (factor))
+GLAD_FUNC_VOID(glGlobalAlphaFactorfSUN, PFNGLGLOBALALPHAFACTORFSUNPROC, (GLfloat factor), (factor))
+GLAD_FUNC_VOID(glGlobalAlphaFactoriSUN, PFNGLGLOBALALPHAFACTORISUNPROC, (GLint factor), (factor))
+GLAD_FUNC_VOID(glGlobalAlphaFactorsSUN, PFNGLGLOBALALPHAFACTORSSUNPROC, (GLshort factor), (factor))
+GLAD_FUNC_VOID(glGlobalAlphaFactorubSUN, PFNGLGLOBALALPHAFACTORUBSUNPROC, (GLubyte factor), (factor))
+GLAD_FUNC_VOID(glGlobalAlphaFactoruiSUN, PFNGLGLOBALALPHAFACTORUISUNPROC, (GLuint factor), (factor))
+GLAD_FUNC_VOID(glGlobalAlphaFactorusSUN, PFNGLGLOBALALPHAFACTORUSSUNPROC, (GLushort factor), (factor))
+GLAD_FUNC_VOID(glHint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode))
+GLAD_FUNC_VOID(glHintPGI, PFNGLHINTPGIPROC, (GLenum target, GLint mode), (target, mode))
+GLAD_FUNC_VOID(glHistogram, PFNGLHISTOGRAMPROC, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink), (target, width, internalformat, sink))
+GLAD_FUNC_VOID(glHistogramEXT, PFNGLHISTOGRAMEXTPROC, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink), (target, width, internalformat, sink))
+GLAD_FUNC_VOID(glIglooInterfaceSGIX, PFNGLIGLOOINTERFACESGIXPROC, (GLenum pname, const void *params), (pname, params))
+GLAD_FUNC_VOID(glImageTransformParameterfHP, PFNGLIMAGETRANSFORMPARAMETERFHPPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_FUNC_VOID(glImageTransformParameterfvHP, PFNGLIMAGETRANSFORMPARAMETERFVHPPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glImageTransformParameteriHP, PFNGLIMAGETRANSFORMPARAMETERIHPPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_FUNC_VOID(glImageTransformParameterivHP, PFNGLIMAGETRANSFORMPARAMETERIVHPPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glImportMemoryFdEXT, PFNGLIMPORTMEMORYFDEXTPROC, (GLuint memory, GLuint64 size, GLenum handleType, GLint fd), (memory, size, handleType, fd))
+GLAD_FUNC_VOID(glImportMemoryWin32HandleEXT, PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC, (GLuint memory, GLuint64 size, GLenum handleType, void *handle), (memory, size, handleType, handle))
+GLAD_FUNC_VOID(glImportMemoryWin32NameEXT, PFNGLIMPORTMEMORYWIN32NAMEEXTPROC, (GLuint memory, GLuint64 size, GLenum handleType, const void *name), (memory, size, handleType, name))
+GLAD_FUNC_VOID(glImportSemaphoreFdEXT, PFNGLIMPORTSEMAPHOREFDEXTPROC, (GLuint semaphore, GLenum handleType, GLint fd), (semaphore, handleType, fd))
+GLAD_FUNC_VOID(glImportSemaphoreWin32HandleEXT, PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC, (GLuint semaphore, GLenum handleType, void *handle), (semaphore, handleType, handle))
+GLAD_FUNC_VOID(glImportSemaphoreWin32NameEXT, PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC, (GLuint semaphore, GLenum handleType, const void *name), (semaphore, handleType, name))
+GLAD_FUNC(GLsync, glImportSyncEXT, PFNGLIMPORTSYNCEXTPROC, (GLenum external_sync_type, GLintptr external_sync, GLbitfield flags), (external_sync_type, external_sync, flags))
+GLAD_FUNC_VOID(glIndexFormatNV, PFNGLINDEXFORMATNVPROC, (GLenum type, GLsizei stride), (type, stride))
+GLAD_FUNC_VOID(glIndexFuncEXT, PFNGLINDEXFUNCEXTPROC, (GLenum func, GLclampf ref), (func, ref))
+GLAD_FUNC_VOID(glIndexMaterialEXT, PFNGLINDEXMATERIALEXTPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_FUNC_VOID(glIndexPointerEXT, PFNGLINDEXPOINTEREXTPROC, (GLenum type, GLsizei stride, GLsizei count, const void *pointer), (type, stride, count, pointer))
+GLAD_FUNC_VOID(glIndexPointerListIBM, PFNGLINDEXPOINTERLISTIBMPROC, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride))
+GLAD_FUNC_VOID(glIndexxOES, PFNGLINDEXXOESPROC, (GLfixed component), (component))
+GLAD_FUNC_VOID(glIndexxvOES, PFNGLINDEXXVOESPROC, (const GLfixed *component), (component))
+GLAD_FUNC_VOID(glInsertComponentEXT, PFNGLINSERTCOMPONENTEXTPROC, (GLuint res, GLuint src, GLuint num), (res, src, num))
+GLAD_FUNC_VOID(glInsertEventMarkerEXT, PFNGLINSERTEVENTMARKEREXTPROC, (GLsizei length, const GLchar *marker), (length, marker))
+GLAD_FUNC_VOID(glInstrumentsBufferSGIX, PFNGLINSTRUMENTSBUFFERSGIXPROC, (GLsizei size, GLint *buffer), (size, buffer))
+GLAD_FUNC_VOID(glInterpolatePathsNV, PFNGLINTERPOLATEPATHSNVPROC, (GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight), (resultPath, pathA, pathB, weight))
+GLAD_FUNC_VOID(glInvalidateBufferData, PFNGLINVALIDATEBUFFERDATAPROC, (GLuint buffer), (buffer))
+GLAD_FUNC_VOID(glInvalidateBufferSubData, PFNGLINVALIDATEBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_FUNC_VOID(glInvalidateFramebuffer, PFNGLINVALIDATEFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments))
+GLAD_FUNC_VOID(glInvalidateNamedFramebufferData, PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments), (framebuffer, numAttachments, attachments))
+GLAD_FUNC_VOID(glInvalidateNamedFramebufferSubData, PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height))
+GLAD_FUNC_VOID(glInvalidateSubFramebuffer, PFNGLINVALIDATESUBFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height))
+GLAD_FUNC_VOID(glInvalidateTexImage, PFNGLINVALIDATETEXIMAGEPROC, (GLuint texture, GLint level), (texture, level))
+GLAD_FUNC_VOID(glInvalidateTexSubImage, PFNGLINVALIDATETEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth))
+GLAD_FUNC(GLboolean, glIsAsyncMarkerSGIX, PFNGLISASYNCMARKERSGIXPROC, (GLuint marker), (marker))
+GLAD_FUNC(GLboolean, glIsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_FUNC(GLboolean, glIsBufferARB, PFNGLISBUFFERARBPROC, (GLuint buffer), (buffer))
+GLAD_FUNC(GLboolean, glIsBufferResidentNV, PFNGLISBUFFERRESIDENTNVPROC, (GLenum target), (target))
+GLAD_FUNC(GLboolean, glIsCommandListNV, PFNGLISCOMMANDLISTNVPROC, (GLuint list), (list))
+GLAD_FUNC(GLboolean, glIsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap))
+GLAD_FUNC(GLboolean, glIsEnabledIndexedEXT, PFNGLISENABLEDINDEXEDEXTPROC, (GLenum target, GLuint index), (target, index))
+GLAD_FUNC(GLboolean, glIsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_FUNC(GLboolean, glIsFenceAPPLE, PFNGLISFENCEAPPLEPROC, (GLuint fence), (fence))
+GLAD_FUNC(GLboolean, glIsFenceNV, PFNGLISFENCENVPROC, (GLuint fence), (fence))
+GLAD_FUNC(GLboolean, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer))
+GLAD_FUNC(GLboolean, glIsFramebufferEXT, PFNGLISFRAMEBUFFEREXTPROC, (GLuint framebuffer), (framebuffer))
+GLAD_FUNC(GLboolean, glIsImageHandleResidentARB, PFNGLISIMAGEHANDLERESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_FUNC(GLboolean, glIsImageHandleResidentNV, PFNGLISIMAGEHANDLERESIDENTNVPROC, (GLuint64 handle), (handle))
+GLAD_FUNC(GLboolean, glIsMemoryObjectEXT, PFNGLISMEMORYOBJECTEXTPROC, (GLuint memoryObject), (memoryObject))
+GLAD_FUNC(GLboolean, glIsNameAMD, PFNGLISNAMEAMDPROC, (GLenum identifier, GLuint name), (identifier, name))
+GLAD_FUNC(GLboolean, glIsNamedBufferResidentNV, PFNGLISNAMEDBUFFERRESIDENTNVPROC, (GLuint buffer), (buffer))
+GLAD_FUNC(GLboolean, glIsNamedStringARB, PFNGLISNAMEDSTRINGARBPROC, (GLint namelen, const GLchar *name), (namelen, name))
+GLAD_FUNC(GLboolean, glIsObjectBufferATI, PFNGLISOBJECTBUFFERATIPROC, (GLuint buffer), (buffer))
+GLAD_FUNC(GLboolean, glIsOcclusionQueryNV, PFNGLISOCCLUSIONQUERYNVPROC, (GLuint id), (id))
+GLAD_FUNC(GLboolean, glIsPathNV, PFNGLISPATHNVPROC, (GLuint path), (path))
+GLAD_FUNC(GLboolean, glIsPointInFillPathNV, PFNGLISPOINTINFILLPATHNVPROC, (GLuint path, GLuint mask, GLfloat x, GLfloat y), (path, mask, x, y))
+GLAD_FUNC(GLboolean, glIsPointInStrokePathNV, PFNGLISPOINTINSTROKEPATHNVPROC, (GLuint path, GLfloat x, GLfloat y), (path, x, y))
+GLAD_FUNC(GLboolean, glIsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program))
+GLAD_FUNC(GLboolean, glIsProgramARB, PFNGLISPROGRAMARBPROC, (GLuint program), (program))
+GLAD_FUNC(GLboolean, glIsProgramNV, PFNGLISPROGRAMNVPROC, (GLuint id), (id))
+GLAD_FUNC(GLboolean, glIsProgramPipeline, PFNGLISPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_FUNC(GLboolean, glIsProgramPipelineEXT, PFNGLISPROGRAMPIPELINEEXTPROC, (GLuint pipeline), (pipeline))
+GLAD_FUNC(GLboolean, glIsQuery, PFNGLISQUERYPROC, (GLuint id), (id))
+GLAD_FUNC(GLboolean, glIsQueryARB, PFNGLISQUERYARBPROC, (GLuint id), (id))
+GLAD_FUNC(GLboolean, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer))
+GLAD_FUNC(GLboolean, glIsRenderbufferEXT, PFNGLISRENDERBUFFEREXTPROC, (GLuint renderbuffer), (renderbuffer))
+GLAD_FUNC(GLboolean, glIsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler))
+GLAD_FUNC(GLboolean, glIsSemaphoreEXT, PFNGLISSEMAPHOREEXTPROC, (GLuint semaphore), (semaphore))
+GLAD_FUNC(GLboolean, glIsShader, PFNGLISSHADERPROC, (GLuint shader), (shader))
+GLAD_FUNC(GLboolean, glIsStateNV, PFNGLISSTATENVPROC, (GLuint state), (state))
+GLAD_FUNC(GLboolean, glIsSync, PFNGLISSYNCPROC, (GLsync sync), (sync))
+GLAD_FUNC(GLboolean, glIsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture))
+GLAD_FUNC(GLboolean, glIsTextureEXT, PFNGLISTEXTUREEXTPROC, (GLuint texture), (texture))
+GLAD_FUNC(GLboolean, glIsTextureHandleResidentARB, PFNGLISTEXTUREHANDLERESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_FUNC(GLboolean, glIsTextureHandleResidentNV, PFNGLISTEXTUREHANDLERESIDENTNVPROC, (GLuint64 handle), (handle))
+GLAD_FUNC(GLboolean, glIsTransformFeedback, PFNGLISTRANSFORMFEEDBACKPROC, (GLuint id), (id))
+GLAD_FUNC(GLboolean, glIsTransformFeedbackNV, PFNGLISTRANSFORMFEEDBACKNVPROC, (GLuint id), (id))
+GLAD_FUNC(GLboolean, glIsVariantEnabledEXT, PFNGLISVARIANTENABLEDEXTPROC, (GLuint id, GLenum cap), (id, cap))
+GLAD_FUNC(GLboolean, glIsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_FUNC(GLboolean, glIsVertexArrayAPPLE, PFNGLISVERTEXARRAYAPPLEPROC, (GLuint array), (array))
+GLAD_FUNC(GLboolean, glIsVertexAttribEnabledAPPLE, PFNGLISVERTEXATTRIBENABLEDAPPLEPROC, (GLuint index, GLenum pname), (index, pname))
+GLAD_FUNC_VOID(glLGPUCopyImageSubDataNVX, PFNGLLGPUCOPYIMAGESUBDATANVXPROC, (GLuint sourceGpu, GLbitfield destinationGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srxY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth), (sourceGpu, destinationGpuMask, srcName, srcTarget, srcLevel, srcX, srxY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth))
+GLAD_FUNC_VOID(glLGPUInterlockNVX, PFNGLLGPUINTERLOCKNVXPROC, (void), ())
+GLAD_FUNC_VOID(glLGPUNamedBufferSubDataNVX, PFNGLLGPUNAMEDBUFFERSUBDATANVXPROC, (GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (gpuMask, buffer, offset, size, data))
+GLAD_FUNC_VOID(glLabelObjectEXT, PFNGLLABELOBJECTEXTPROC, (GLenum type, GLuint object, GLsizei length, const GLchar *label), (type, object, length, label))
+GLAD_FUNC_VOID(glLightEnviSGIX, PFNGLLIGHTENVISGIXPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glLightModelxOES, PFNGLLIGHTMODELXOESPROC, (GLenum pname, GLfixed param), (pname, param))
+GLAD_FUNC_VOID(glLightModelxvOES, PFNGLLIGHTMODELXVOESPROC, (GLenum pname, const GLfixed *param), (pname, param))
+GLAD_FUNC_VOID(glLightxOES, PFNGLLIGHTXOESPROC, (GLenum light, GLenum pname, GLfixed param), (light, pname, param))
+GLAD_FUNC_VOID(glLightxvOES, PFNGLLIGHTXVOESPROC, (GLenum light, GLenum pname, const GLfixed *params), (light, pname, params))
+GLAD_FUNC_VOID(glLineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width))
+GLAD_FUNC_VOID(glLineWidthxOES, PFNGLLINEWIDTHXOESPROC, (GLfixed width), (width))
+GLAD_FUNC_VOID(glLinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program))
+GLAD_FUNC_VOID(glLinkProgramARB, PFNGLLINKPROGRAMARBPROC, (GLhandleARB programObj), (programObj))
+GLAD_FUNC_VOID(glListDrawCommandsStatesClientNV, PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC, (GLuint list, GLuint segment, const void **indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (list, segment, indirects, sizes, states, fbos, count))
+GLAD_FUNC_VOID(glListParameterfSGIX, PFNGLLISTPARAMETERFSGIXPROC, (GLuint list, GLenum pname, GLfloat param), (list, pname, param))
+GLAD_FUNC_VOID(glListParameterfvSGIX, PFNGLLISTPARAMETERFVSGIXPROC, (GLuint list, GLenum pname, const GLfloat *params), (list, pname, params))
+GLAD_FUNC_VOID(glListParameteriSGIX, PFNGLLISTPARAMETERISGIXPROC, (GLuint list, GLenum pname, GLint param), (list, pname, param))
+GLAD_FUNC_VOID(glListParameterivSGIX, PFNGLLISTPARAMETERIVSGIXPROC, (GLuint list, GLenum pname, const GLint *params), (list, pname, params))
+GLAD_FUNC_VOID(glLoadIdentityDeformationMapSGIX, PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC, (GLbitfield mask), (mask))
+GLAD_FUNC_VOID(glLoadMatrixxOES, PFNGLLOADMATRIXXOESPROC, (const GLfixed *m), (m))
+GLAD_FUNC_VOID(glLoadProgramNV, PFNGLLOADPROGRAMNVPROC, (GLenum target, GLuint id, GLsizei len, const GLubyte *program), (target, id, len, program))
+GLAD_FUNC_VOID(glLoadTransposeMatrixdARB, PFNGLLOADTRANSPOSEMATRIXDARBPROC, (const GLdouble *m), (m))
+GLAD_FUNC_VOID(glLoadTransposeMatrixfARB, PFNGLLOADTRANSPOSEMATRIXFARBPROC, (const GLfloat *m), (m))
+GLAD_FUNC_VOID(glLoadTransposeMatrixxOES, PFNGLLOADTRANSPOSEMATRIXXOESPROC, (const GLfixed *m), (m))
+GLAD_FUNC_VOID(glLockArraysEXT, PFNGLLOCKARRAYSEXTPROC, (GLint first, GLsizei count), (first, count))
+GLAD_FUNC_VOID(glLogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode))
+GLAD_FUNC_VOID(glMakeBufferNonResidentNV, PFNGLMAKEBUFFERNONRESIDENTNVPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glMakeBufferResidentNV, PFNGLMAKEBUFFERRESIDENTNVPROC, (GLenum target, GLenum access), (target, access))
+GLAD_FUNC_VOID(glMakeImageHandleNonResidentARB, PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_FUNC_VOID(glMakeImageHandleNonResidentNV, PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC, (GLuint64 handle), (handle))
+GLAD_FUNC_VOID(glMakeImageHandleResidentARB, PFNGLMAKEIMAGEHANDLERESIDENTARBPROC, (GLuint64 handle, GLenum access), (handle, access))
+GLAD_FUNC_VOID(glMakeImageHandleResidentNV, PFNGLMAKEIMAGEHANDLERESIDENTNVPROC, (GLuint64 handle, GLenum access), (handle, access))
+GLAD_FUNC_VOID(glMakeNamedBufferNonResidentNV, PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC, (GLuint buffer), (buffer))
+GLAD_FUNC_VOID(glMakeNamedBufferResidentNV, PFNGLMAKENAMEDBUFFERRESIDENTNVPROC, (GLuint buffer, GLenum access), (buffer, access))
+GLAD_FUNC_VOID(glMakeTextureHandleNonResidentARB, PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_FUNC_VOID(glMakeTextureHandleNonResidentNV, PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC, (GLuint64 handle), (handle))
+GLAD_FUNC_VOID(glMakeTextureHandleResidentARB, PFNGLMAKETEXTUREHANDLERESIDENTARBPROC, (GLuint64 handle), (handle))
+GLAD_FUNC_VOID(glMakeTextureHandleResidentNV, PFNGLMAKETEXTUREHANDLERESIDENTNVPROC, (GLuint64 handle), (handle))
+GLAD_FUNC_VOID(glMap1xOES, PFNGLMAP1XOESPROC, (GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points), (target, u1, u2, stride, order, points))
+GLAD_FUNC_VOID(glMap2xOES, PFNGLMAP2XOESPROC, (GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GLAD_FUNC(void *, glMapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access))
+GLAD_FUNC(void *, glMapBufferARB, PFNGLMAPBUFFERARBPROC, (GLenum target, GLenum access), (target, access))
+GLAD_FUNC(void *, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GLAD_FUNC_VOID(glMapControlPointsNV, PFNGLMAPCONTROLPOINTSNVPROC, (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void *points), (target, index, type, ustride, vstride, uorder, vorder, packed, points))
+GLAD_FUNC_VOID(glMapGrid1xOES, PFNGLMAPGRID1XOESPROC, (GLint n, GLfixed u1, GLfixed u2), (n, u1, u2))
+GLAD_FUNC_VOID(glMapGrid2xOES, PFNGLMAPGRID2XOESPROC, (GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2), (n, u1, u2, v1, v2))
+GLAD_FUNC(void *, glMapNamedBuffer, PFNGLMAPNAMEDBUFFERPROC, (GLuint buffer, GLenum access), (buffer, access))
+GLAD_FUNC(void *, glMapNamedBufferEXT, PFNGLMAPNAMEDBUFFEREXTPROC, (GLuint buffer, GLenum access), (buffer, access))
+GLAD_FUNC(void *, glMapNamedBufferRange, PFNGLMAPNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access))
+GLAD_FUNC(void *, glMapNamedBufferRangeEXT, PFNGLMAPNAMEDBUFFERRANGEEXTPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access))
+GLAD_FUNC(void *, glMapObjectBufferATI, PFNGLMAPOBJECTBUFFERATIPROC, (GLuint buffer), (buffer))
+GLAD_FUNC_VOID(glMapParameterfvNV, PFNGLMAPPARAMETERFVNVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glMapParameterivNV, PFNGLMAPPARAMETERIVNVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC(void *, glMapTexture2DINTEL, PFNGLMAPTEXTURE2DINTELPROC, (GLuint texture, GLint level, GLbitfield access, GLint *stride, GLenum *layout), (texture, level, access, stride, layout))
+GLAD_FUNC_VOID(glMapVertexAttrib1dAPPLE, PFNGLMAPVERTEXATTRIB1DAPPLEPROC, (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points), (index, size, u1, u2, stride, order, points))
+GLAD_FUNC_VOID(glMapVertexAttrib1fAPPLE, PFNGLMAPVERTEXATTRIB1FAPPLEPROC, (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points), (index, size, u1, u2, stride, order, points))
+GLAD_FUNC_VOID(glMapVertexAttrib2dAPPLE, PFNGLMAPVERTEXATTRIB2DAPPLEPROC, (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points), (index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GLAD_FUNC_VOID(glMapVertexAttrib2fAPPLE, PFNGLMAPVERTEXATTRIB2FAPPLEPROC, (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points), (index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GLAD_FUNC_VOID(glMaterialxOES, PFNGLMATERIALXOESPROC, (GLenum face, GLenum pname, GLfixed param), (face, pname, param))
+GLAD_FUNC_VOID(glMaterialxvOES, PFNGLMATERIALXVOESPROC, (GLenum face, GLenum pname, const GLfixed *param), (face, pname, param))
+GLAD_FUNC_VOID(glMatrixFrustumEXT, PFNGLMATRIXFRUSTUMEXTPROC, (GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (mode, left, right, bottom, top, zNear, zFar))
+GLAD_FUNC_VOID(glMatrixIndexPointerARB, PFNGLMATRIXINDEXPOINTERARBPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_FUNC_VOID(glMatrixIndexubvARB, PFNGLMATRIXINDEXUBVARBPROC, (GLint size, const GLubyte *indices), (size, indices))
+GLAD_FUNC_VOID(glMatrixIndexuivARB, PFNGLMATRIXINDEXUIVARBPROC, (GLint size, const GLuint *indices), (size, indices))
+GLAD_FUNC_VOID(glMatrixIndexusvARB, PFNGLMATRIXINDEXUSVARBPROC, (GLint size, const GLushort *indices), (size, indices))
+GLAD_FUNC_VOID(glMatrixLoad3x2fNV, PFNGLMATRIXLOAD3X2FNVPROC, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GLAD_FUNC_VOID(glMatrixLoad3x3fNV, PFNGLMATRIXLOAD3X3FNVPROC, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GLAD_FUNC_VOID(glMatrixLoadIdentityEXT, PFNGLMATRIXLOADIDENTITYEXTPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glMatrixLoadTranspose3x3fNV, PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GLAD_FUNC_VOID(glMatrixLoadTransposedEXT, PFNGLMATRIXLOADTRANSPOSEDEXTPROC, (GLenum mode, const GLdouble *m), (mode, m))
+GLAD_FUNC_VOID(glMatrixLoadTransposefEXT, PFNGLMATRIXLOADTRANSPOSEFEXTPROC, (GLenum mode, const GLfloat *m), (mode, m))
+GLAD_FUNC_VOID(glMatrixLoaddEXT, PFNGLMATRIXLOADDEXTPROC, (GLenum mode, const GLdouble *m), (mode, m))
+GLAD_FUNC_VOID(glMatrixLoadfEXT, PFNGLMATRIXLOADFEXTPROC, (GLenum mode, const GLfloat *m), (mode, m))
+GLAD_FUNC_VOID(glMatrixMult3x2fNV, PFNGLMATRIXMULT3X2FNVPROC, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GLAD_FUNC_VOID(glMatrixMult3x3fNV, PFNGLMATRIXMULT3X3FNVPROC, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GLAD_FUNC_VOID(glMatrixMultTranspose3x3fNV, PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GLAD_FUNC_VOID(glMatrixMultTransposedEXT, PFNGLMATRIXMULTTRANSPOSEDEXTPROC, (GLenum mode, const GLdouble *m), (mode, m))
+GLAD_FUNC_VOID(glMatrixMultTransposefEXT, PFNGLMATRIXMULTTRANSPOSEFEXTPROC, (GLenum mode, const GLfloat *m), (mode, m))
+GLAD_FUNC_VOID(glMatrixMultdEXT, PFNGLMATRIXMULTDEXTPROC, (GLenum mode, const GLdouble *m), (mode, m))
+GLAD_FUNC_VOID(glMatrixMultfEXT, PFNGLMATRIXMULTFEXTPROC, (GLenum mode, const GLfloat *m), (mode, m))
+GLAD_FUNC_VOID(glMatrixOrthoEXT, PFNGLMATRIXORTHOEXTPROC, (GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (mode, left, right, bottom, top, zNear, zFar))
+GLAD_FUNC_VOID(glMatrixPopEXT, PFNGLMATRIXPOPEXTPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glMatrixPushEXT, PFNGLMATRIXPUSHEXTPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glMatrixRotatedEXT, PFNGLMATRIXROTATEDEXTPROC, (GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z), (mode, angle, x, y, z))
+GLAD_FUNC_VOID(glMatrixRotatefEXT, PFNGLMATRIXROTATEFEXTPROC, (GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z), (mode, angle, x, y, z))
+GLAD_FUNC_VOID(glMatrixScaledEXT, PFNGLMATRIXSCALEDEXTPROC, (GLenum mode, GLdouble x, GLdouble y, GLdouble z), (mode, x, y, z))
+GLAD_FUNC_VOID(glMatrixScalefEXT, PFNGLMATRIXSCALEFEXTPROC, (GLenum mode, GLfloat x, GLfloat y, GLfloat z), (mode, x, y, z))
+GLAD_FUNC_VOID(glMatrixTranslatedEXT, PFNGLMATRIXTRANSLATEDEXTPROC, (GLenum mode, GLdouble x, GLdouble y, GLdouble z), (mode, x, y, z))
+GLAD_FUNC_VOID(glMatrixTranslatefEXT, PFNGLMATRIXTRANSLATEFEXTPROC, (GLenum mode, GLfloat x, GLfloat y, GLfloat z), (mode, x, y, z))
+GLAD_FUNC_VOID(glMaxShaderCompilerThreadsARB, PFNGLMAXSHADERCOMPILERTHREADSARBPROC, (GLuint count), (count))
+GLAD_FUNC_VOID(glMaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, (GLuint count), (count))
+GLAD_FUNC_VOID(glMemoryBarrier, PFNGLMEMORYBARRIERPROC, (GLbitfield barriers), (barriers))
+GLAD_FUNC_VOID(glMemoryBarrierByRegion, PFNGLMEMORYBARRIERBYREGIONPROC, (GLbitfield barriers), (barriers))
+GLAD_FUNC_VOID(glMemoryBarrierEXT, PFNGLMEMORYBARRIEREXTPROC, (GLbitfield barriers), (barriers))
+GLAD_FUNC_VOID(glMemoryObjectParameterivEXT, PFNGLMEMORYOBJECTPARAMETERIVEXTPROC, (GLuint memoryObject, GLenum pname, const GLint *params), (memoryObject, pname, params))
+GLAD_FUNC_VOID(glMinSampleShadingARB, PFNGLMINSAMPLESHADINGARBPROC, (GLfloat value), (value))
+GLAD_FUNC_VOID(glMinmax, PFNGLMINMAXPROC, (GLenum target, GLenum internalformat, GLboolean sink), (target, internalformat, sink))
+GLAD_FUNC_VOID(glMinmaxEXT, PFNGLMINMAXEXTPROC, (GLenum target, GLenum internalformat, GLboolean sink), (target, internalformat, sink))
+GLAD_FUNC_VOID(glMultMatrixxOES, PFNGLMULTMATRIXXOESPROC, (const GLfixed *m), (m))
+GLAD_FUNC_VOID(glMultTransposeMatrixdARB, PFNGLMULTTRANSPOSEMATRIXDARBPROC, (const GLdouble *m), (m))
+GLAD_FUNC_VOID(glMultTransposeMatrixfARB, PFNGLMULTTRANSPOSEMATRIXFARBPROC, (const GLfloat *m), (m))
+GLAD_FUNC_VOID(glMultTransposeMatrixxOES, PFNGLMULTTRANSPOSEMATRIXXOESPROC, (const GLfixed *m), (m))
+GLAD_FUNC_VOID(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GLAD_FUNC_VOID(glMultiDrawArraysEXT, PFNGLMULTIDRAWARRAYSEXTPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, first, count, primcount))
+GLAD_FUNC_VOID(glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride))
+GLAD_FUNC_VOID(glMultiDrawArraysIndirectAMD, PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC, (GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride), (mode, indirect, primcount, stride))
+GLAD_FUNC_VOID(glMultiDrawArraysIndirectBindlessCountNV, PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC, (GLenum mode, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount), (mode, indirect, drawCount, maxDrawCount, stride, vertexBufferCount))
+GLAD_FUNC_VOID(glMultiDrawArraysIndirectBindlessNV, PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC, (GLenum mode, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount), (mode, indirect, drawCount, stride, vertexBufferCount))
+GLAD_FUNC_VOID(glMultiDrawArraysIndirectCountARB, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride))
+GLAD_FUNC_VOID(glMultiDrawElementArrayAPPLE, PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, first, count, primcount))
+GLAD_FUNC_VOID(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GLAD_FUNC_VOID(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GLAD_FUNC_VOID(glMultiDrawElementsEXT, PFNGLMULTIDRAWELEMENTSEXTPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount), (mode, count, type, indices, primcount))
+GLAD_FUNC_VOID(glMultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride))
+GLAD_FUNC_VOID(glMultiDrawElementsIndirectAMD, PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC, (GLenum mode, GLenum type, const void *indirect, GLsizei primcount, GLsizei stride), (mode, type, indirect, primcount, stride))
+GLAD_FUNC_VOID(glMultiDrawElementsIndirectBindlessCountNV, PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC, (GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount), (mode, type, indirect, drawCount, maxDrawCount, stride, vertexBufferCount))
+GLAD_FUNC_VOID(glMultiDrawElementsIndirectBindlessNV, PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC, (GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount), (mode, type, indirect, drawCount, stride, vertexBufferCount))
+GLAD_FUNC_VOID(glMultiDrawElementsIndirectCountARB, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride))
+GLAD_FUNC_VOID(glMultiDrawMeshTasksIndirectCountEXT, PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTEXTPROC, (GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (indirect, drawcount, maxdrawcount, stride))
+GLAD_FUNC_VOID(glMultiDrawMeshTasksIndirectCountNV, PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTNVPROC, (GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (indirect, drawcount, maxdrawcount, stride))
+GLAD_FUNC_VOID(glMultiDrawMeshTasksIndirectEXT, PFNGLMULTIDRAWMESHTASKSINDIRECTEXTPROC, (GLintptr indirect, GLsizei drawcount, GLsizei stride), (indirect, drawcount, stride))
+GLAD_FUNC_VOID(glMultiDrawMeshTasksIndirectNV, PFNGLMULTIDRAWMESHTASKSINDIRECTNVPROC, (GLintptr indirect, GLsizei drawcount, GLsizei stride), (indirect, drawcount, stride))
+GLAD_FUNC_VOID(glMultiDrawRangeElementArrayAPPLE, PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC, (GLenum mode, GLuint start, GLuint end, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, start, end, first, count, primcount))
+GLAD_FUNC_VOID(glMultiModeDrawArraysIBM, PFNGLMULTIMODEDRAWARRAYSIBMPROC, (const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride), (mode, first, count, primcount, modestride))
+GLAD_FUNC_VOID(glMultiModeDrawElementsIBM, PFNGLMULTIMODEDRAWELEMENTSIBMPROC, (const GLenum *mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount, GLint modestride), (mode, count, type, indices, primcount, modestride))
+GLAD_FUNC_VOID(glMultiTexBufferEXT, PFNGLMULTITEXBUFFEREXTPROC, (GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer), (texunit, target, internalformat, buffer))
+GLAD_FUNC_VOID(glMultiTexCoord1bOES, PFNGLMULTITEXCOORD1BOESPROC, (GLenum texture, GLbyte s), (texture, s))
+GLAD_FUNC_VOID(glMultiTexCoord1bvOES, PFNGLMULTITEXCOORD1BVOESPROC, (GLenum texture, const GLbyte *coords), (texture, coords))
+GLAD_FUNC_VOID(glMultiTexCoord1dARB, PFNGLMULTITEXCOORD1DARBPROC, (GLenum target, GLdouble s), (target, s))
+GLAD_FUNC_VOID(glMultiTexCoord1dvARB, PFNGLMULTITEXCOORD1DVARBPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord1fARB, PFNGLMULTITEXCOORD1FARBPROC, (GLenum target, GLfloat s), (target, s))
+GLAD_FUNC_VOID(glMultiTexCoord1fvARB, PFNGLMULTITEXCOORD1FVARBPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord1hNV, PFNGLMULTITEXCOORD1HNVPROC, (GLenum target, GLhalfNV s), (target, s))
+GLAD_FUNC_VOID(glMultiTexCoord1hvNV, PFNGLMULTITEXCOORD1HVNVPROC, (GLenum target, const GLhalfNV *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord1iARB, PFNGLMULTITEXCOORD1IARBPROC, (GLenum target, GLint s), (target, s))
+GLAD_FUNC_VOID(glMultiTexCoord1ivARB, PFNGLMULTITEXCOORD1IVARBPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord1sARB, PFNGLMULTITEXCOORD1SARBPROC, (GLenum target, GLshort s), (target, s))
+GLAD_FUNC_VOID(glMultiTexCoord1svARB, PFNGLMULTITEXCOORD1SVARBPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord1xOES, PFNGLMULTITEXCOORD1XOESPROC, (GLenum texture, GLfixed s), (texture, s))
+GLAD_FUNC_VOID(glMultiTexCoord1xvOES, PFNGLMULTITEXCOORD1XVOESPROC, (GLenum texture, const GLfixed *coords), (texture, coords))
+GLAD_FUNC_VOID(glMultiTexCoord2bOES, PFNGLMULTITEXCOORD2BOESPROC, (GLenum texture, GLbyte s, GLbyte t), (texture, s, t))
+GLAD_FUNC_VOID(glMultiTexCoord2bvOES, PFNGLMULTITEXCOORD2BVOESPROC, (GLenum texture, const GLbyte *coords), (texture, coords))
+GLAD_FUNC_VOID(glMultiTexCoord2dARB, PFNGLMULTITEXCOORD2DARBPROC, (GLenum target, GLdouble s, GLdouble t), (target, s, t))
+GLAD_FUNC_VOID(glMultiTexCoord2dvARB, PFNGLMULTITEXCOORD2DVARBPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord2fARB, PFNGLMULTITEXCOORD2FARBPROC, (GLenum target, GLfloat s, GLfloat t), (target, s, t))
+GLAD_FUNC_VOID(glMultiTexCoord2fvARB, PFNGLMULTITEXCOORD2FVARBPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord2hNV, PFNGLMULTITEXCOORD2HNVPROC, (GLenum target, GLhalfNV s, GLhalfNV t), (target, s, t))
+GLAD_FUNC_VOID(glMultiTexCoord2hvNV, PFNGLMULTITEXCOORD2HVNVPROC, (GLenum target, const GLhalfNV *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord2iARB, PFNGLMULTITEXCOORD2IARBPROC, (GLenum target, GLint s, GLint t), (target, s, t))
+GLAD_FUNC_VOID(glMultiTexCoord2ivARB, PFNGLMULTITEXCOORD2IVARBPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord2sARB, PFNGLMULTITEXCOORD2SARBPROC, (GLenum target, GLshort s, GLshort t), (target, s, t))
+GLAD_FUNC_VOID(glMultiTexCoord2svARB, PFNGLMULTITEXCOORD2SVARBPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord2xOES, PFNGLMULTITEXCOORD2XOESPROC, (GLenum texture, GLfixed s, GLfixed t), (texture, s, t))
+GLAD_FUNC_VOID(glMultiTexCoord2xvOES, PFNGLMULTITEXCOORD2XVOESPROC, (GLenum texture, const GLfixed *coords), (texture, coords))
+GLAD_FUNC_VOID(glMultiTexCoord3bOES, PFNGLMULTITEXCOORD3BOESPROC, (GLenum texture, GLbyte s, GLbyte t, GLbyte r), (texture, s, t, r))
+GLAD_FUNC_VOID(glMultiTexCoord3bvOES, PFNGLMULTITEXCOORD3BVOESPROC, (GLenum texture, const GLbyte *coords), (texture, coords))
+GLAD_FUNC_VOID(glMultiTexCoord3dARB, PFNGLMULTITEXCOORD3DARBPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r))
+GLAD_FUNC_VOID(glMultiTexCoord3dvARB, PFNGLMULTITEXCOORD3DVARBPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord3fARB, PFNGLMULTITEXCOORD3FARBPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r))
+GLAD_FUNC_VOID(glMultiTexCoord3fvARB, PFNGLMULTITEXCOORD3FVARBPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord3hNV, PFNGLMULTITEXCOORD3HNVPROC, (GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r), (target, s, t, r))
+GLAD_FUNC_VOID(glMultiTexCoord3hvNV, PFNGLMULTITEXCOORD3HVNVPROC, (GLenum target, const GLhalfNV *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord3iARB, PFNGLMULTITEXCOORD3IARBPROC, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r))
+GLAD_FUNC_VOID(glMultiTexCoord3ivARB, PFNGLMULTITEXCOORD3IVARBPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord3sARB, PFNGLMULTITEXCOORD3SARBPROC, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r))
+GLAD_FUNC_VOID(glMultiTexCoord3svARB, PFNGLMULTITEXCOORD3SVARBPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord3xOES, PFNGLMULTITEXCOORD3XOESPROC, (GLenum texture, GLfixed s, GLfixed t, GLfixed r), (texture, s, t, r))
+GLAD_FUNC_VOID(glMultiTexCoord3xvOES, PFNGLMULTITEXCOORD3XVOESPROC, (GLenum texture, const GLfixed *coords), (texture, coords))
+GLAD_FUNC_VOID(glMultiTexCoord4bOES, PFNGLMULTITEXCOORD4BOESPROC, (GLenum texture, GLbyte s, GLbyte t, GLbyte r, GLbyte q), (texture, s, t, r, q))
+GLAD_FUNC_VOID(glMultiTexCoord4bvOES, PFNGLMULTITEXCOORD4BVOESPROC, (GLenum texture, const GLbyte *coords), (texture, coords))
+GLAD_FUNC_VOID(glMultiTexCoord4dARB, PFNGLMULTITEXCOORD4DARBPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q))
+GLAD_FUNC_VOID(glMultiTexCoord4dvARB, PFNGLMULTITEXCOORD4DVARBPROC, (GLenum target, const GLdouble *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord4fARB, PFNGLMULTITEXCOORD4FARBPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q))
+GLAD_FUNC_VOID(glMultiTexCoord4fvARB, PFNGLMULTITEXCOORD4FVARBPROC, (GLenum target, const GLfloat *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord4hNV, PFNGLMULTITEXCOORD4HNVPROC, (GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q), (target, s, t, r, q))
+GLAD_FUNC_VOID(glMultiTexCoord4hvNV, PFNGLMULTITEXCOORD4HVNVPROC, (GLenum target, const GLhalfNV *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord4iARB, PFNGLMULTITEXCOORD4IARBPROC, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q))
+GLAD_FUNC_VOID(glMultiTexCoord4ivARB, PFNGLMULTITEXCOORD4IVARBPROC, (GLenum target, const GLint *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord4sARB, PFNGLMULTITEXCOORD4SARBPROC, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q))
+GLAD_FUNC_VOID(glMultiTexCoord4svARB, PFNGLMULTITEXCOORD4SVARBPROC, (GLenum target, const GLshort *v), (target, v))
+GLAD_FUNC_VOID(glMultiTexCoord4xOES, PFNGLMULTITEXCOORD4XOESPROC, (GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q), (texture, s, t, r, q))
+GLAD_FUNC_VOID(glMultiTexCoord4xvOES, PFNGLMULTITEXCOORD4XVOESPROC, (GLenum texture, const GLfixed *coords), (texture, coords))
+GLAD_FUNC_VOID(glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_FUNC_VOID(glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_FUNC_VOID(glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_FUNC_VOID(glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_FUNC_VOID(glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_FUNC_VOID(glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_FUNC_VOID(glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_FUNC_VOID(glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_FUNC_VOID(glMultiTexCoordPointerEXT, PFNGLMULTITEXCOORDPOINTEREXTPROC, (GLenum texunit, GLint size, GLenum type, GLsizei stride, const void *pointer), (texunit, size, type, stride, pointer))
+GLAD_FUNC_VOID(glMultiTexEnvfEXT, PFNGLMULTITEXENVFEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLfloat param), (texunit, target, pname, param))
+GLAD_FUNC_VOID(glMultiTexEnvfvEXT, PFNGLMULTITEXENVFVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, const GLfloat *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glMultiTexEnviEXT, PFNGLMULTITEXENVIEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLint param), (texunit, target, pname, param))
+GLAD_FUNC_VOID(glMultiTexEnvivEXT, PFNGLMULTITEXENVIVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glMultiTexGendEXT, PFNGLMULTITEXGENDEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, GLdouble param), (texunit, coord, pname, param))
+GLAD_FUNC_VOID(glMultiTexGendvEXT, PFNGLMULTITEXGENDVEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params), (texunit, coord, pname, params))
+GLAD_FUNC_VOID(glMultiTexGenfEXT, PFNGLMULTITEXGENFEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, GLfloat param), (texunit, coord, pname, param))
+GLAD_FUNC_VOID(glMultiTexGenfvEXT, PFNGLMULTITEXGENFVEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params), (texunit, coord, pname, params))
+GLAD_FUNC_VOID(glMultiTexGeniEXT, PFNGLMULTITEXGENIEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, GLint param), (texunit, coord, pname, param))
+GLAD_FUNC_VOID(glMultiTexGenivEXT, PFNGLMULTITEXGENIVEXTPROC, (GLenum texunit, GLenum coord, GLenum pname, const GLint *params), (texunit, coord, pname, params))
+GLAD_FUNC_VOID(glMultiTexImage1DEXT, PFNGLMULTITEXIMAGE1DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, border, format, type, pixels))
+GLAD_FUNC_VOID(glMultiTexImage2DEXT, PFNGLMULTITEXIMAGE2DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_FUNC_VOID(glMultiTexImage3DEXT, PFNGLMULTITEXIMAGE3DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_FUNC_VOID(glMultiTexParameterIivEXT, PFNGLMULTITEXPARAMETERIIVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glMultiTexParameterIuivEXT, PFNGLMULTITEXPARAMETERIUIVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, const GLuint *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glMultiTexParameterfEXT, PFNGLMULTITEXPARAMETERFEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLfloat param), (texunit, target, pname, param))
+GLAD_FUNC_VOID(glMultiTexParameterfvEXT, PFNGLMULTITEXPARAMETERFVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, const GLfloat *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glMultiTexParameteriEXT, PFNGLMULTITEXPARAMETERIEXTPROC, (GLenum texunit, GLenum target, GLenum pname, GLint param), (texunit, target, pname, param))
+GLAD_FUNC_VOID(glMultiTexParameterivEXT, PFNGLMULTITEXPARAMETERIVEXTPROC, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params))
+GLAD_FUNC_VOID(glMultiTexRenderbufferEXT, PFNGLMULTITEXRENDERBUFFEREXTPROC, (GLenum texunit, GLenum target, GLuint renderbuffer), (texunit, target, renderbuffer))
+GLAD_FUNC_VOID(glMultiTexSubImage1DEXT, PFNGLMULTITEXSUBIMAGE1DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, width, format, type, pixels))
+GLAD_FUNC_VOID(glMultiTexSubImage2DEXT, PFNGLMULTITEXSUBIMAGE2DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_FUNC_VOID(glMultiTexSubImage3DEXT, PFNGLMULTITEXSUBIMAGE3DEXTPROC, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_FUNC_VOID(glMulticastBarrierNV, PFNGLMULTICASTBARRIERNVPROC, (void), ())
+GLAD_FUNC_VOID(glMulticastBlitFramebufferNV, PFNGLMULTICASTBLITFRAMEBUFFERNVPROC, (GLuint srcGpu, GLuint dstGpu, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcGpu, dstGpu, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_FUNC_VOID(glMulticastBufferSubDataNV, PFNGLMULTICASTBUFFERSUBDATANVPROC, (GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (gpuMask, buffer, offset, size, data))
+GLAD_FUNC_VOID(glMulticastCopyBufferSubDataNV, PFNGLMULTICASTCOPYBUFFERSUBDATANVPROC, (GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size))
+GLAD_FUNC_VOID(glMulticastCopyImageSubDataNV, PFNGLMULTICASTCOPYIMAGESUBDATANVPROC, (GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth))
+GLAD_FUNC_VOID(glMulticastFramebufferSampleLocationsfvNV, PFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC, (GLuint gpu, GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (gpu, framebuffer, start, count, v))
+GLAD_FUNC_VOID(glMulticastGetQueryObjecti64vNV, PFNGLMULTICASTGETQUERYOBJECTI64VNVPROC, (GLuint gpu, GLuint id, GLenum pname, GLint64 *params), (gpu, id, pname, params))
+GLAD_FUNC_VOID(glMulticastGetQueryObjectivNV, PFNGLMULTICASTGETQUERYOBJECTIVNVPROC, (GLuint gpu, GLuint id, GLenum pname, GLint *params), (gpu, id, pname, params))
+GLAD_FUNC_VOID(glMulticastGetQueryObjectui64vNV, PFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC, (GLuint gpu, GLuint id, GLenum pname, GLuint64 *params), (gpu, id, pname, params))
+GLAD_FUNC_VOID(glMulticastGetQueryObjectuivNV, PFNGLMULTICASTGETQUERYOBJECTUIVNVPROC, (GLuint gpu, GLuint id, GLenum pname, GLuint *params), (gpu, id, pname, params))
+GLAD_FUNC_VOID(glMulticastScissorArrayvNVX, PFNGLMULTICASTSCISSORARRAYVNVXPROC, (GLuint gpu, GLuint first, GLsizei count, const GLint *v), (gpu, first, count, v))
+GLAD_FUNC_VOID(glMulticastViewportArrayvNVX, PFNGLMULTICASTVIEWPORTARRAYVNVXPROC, (GLuint gpu, GLuint first, GLsizei count, const GLfloat *v), (gpu, first, count, v))
+GLAD_FUNC_VOID(glMulticastViewportPositionWScaleNVX, PFNGLMULTICASTVIEWPORTPOSITIONWSCALENVXPROC, (GLuint gpu, GLuint index, GLfloat xcoeff, GLfloat ycoeff), (gpu, index, xcoeff, ycoeff))
+GLAD_FUNC_VOID(glMulticastWaitSyncNV, PFNGLMULTICASTWAITSYNCNVPROC, (GLuint signalGpu, GLbitfield waitGpuMask), (signalGpu, waitGpuMask))
+GLAD_FUNC_VOID(glNamedBufferAttachMemoryNV, PFNGLNAMEDBUFFERATTACHMEMORYNVPROC, (GLuint buffer, GLuint memory, GLuint64 offset), (buffer, memory, offset))
+GLAD_FUNC_VOID(glNamedBufferData, PFNGLNAMEDBUFFERDATAPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage))
+GLAD_FUNC_VOID(glNamedBufferDataEXT, PFNGLNAMEDBUFFERDATAEXTPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage))
+GLAD_FUNC_VOID(glNamedBufferPageCommitmentARB, PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit), (buffer, offset, size, commit))
+GLAD_FUNC_VOID(glNamedBufferPageCommitmentEXT, PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit), (buffer, offset, size, commit))
+GLAD_FUNC_VOID(glNamedBufferPageCommitmentMemNV, PFNGLNAMEDBUFFERPAGECOMMITMENTMEMNVPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLuint memory, GLuint64 memOffset, GLboolean commit), (buffer, offset, size, memory, memOffset, commit))
+GLAD_FUNC_VOID(glNamedBufferStorage, PFNGLNAMEDBUFFERSTORAGEPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags))
+GLAD_FUNC_VOID(glNamedBufferStorageEXT, PFNGLNAMEDBUFFERSTORAGEEXTPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags))
+GLAD_FUNC_VOID(glNamedBufferStorageExternalEXT, PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags), (buffer, offset, size, clientBuffer, flags))
+GLAD_FUNC_VOID(glNamedBufferStorageMemEXT, PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC, (GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset), (buffer, size, memory, offset))
+GLAD_FUNC_VOID(glNamedBufferSubData, PFNGLNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data))
+GLAD_FUNC_VOID(glNamedBufferSubDataEXT, PFNGLNAMEDBUFFERSUBDATAEXTPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data))
+GLAD_FUNC_VOID(glNamedCopyBufferSubDataEXT, PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size))
+GLAD_FUNC_VOID(glNamedFramebufferDrawBuffer, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, (GLuint framebuffer, GLenum buf), (framebuffer, buf))
+GLAD_FUNC_VOID(glNamedFramebufferDrawBuffers, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs))
+GLAD_FUNC_VOID(glNamedFramebufferParameteri, PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param))
+GLAD_FUNC_VOID(glNamedFramebufferParameteriEXT, PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param))
+GLAD_FUNC_VOID(glNamedFramebufferReadBuffer, PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, (GLuint framebuffer, GLenum src), (framebuffer, src))
+GLAD_FUNC_VOID(glNamedFramebufferRenderbuffer, PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer))
+GLAD_FUNC_VOID(glNamedFramebufferRenderbufferEXT, PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer))
+GLAD_FUNC_VOID(glNamedFramebufferSampleLocationsfvARB, PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC, (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (framebuffer, start, count, v))
+GLAD_FUNC_VOID(glNamedFramebufferSampleLocationsfvNV, PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC, (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (framebuffer, start, count, v))
+GLAD_FUNC_VOID(glNamedFramebufferSamplePositionsfvAMD, PFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC, (GLuint framebuffer, GLuint numsamples, GLuint pixelindex, const GLfloat *values), (framebuffer, numsamples, pixelindex, values))
+GLAD_FUNC_VOID(glNamedFramebufferTexture, PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level))
+GLAD_FUNC_VOID(glNamedFramebufferTexture1DEXT, PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (framebuffer, attachment, textarget, texture, level))
+GLAD_FUNC_VOID(glNamedFramebufferTexture2DEXT, PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (framebuffer, attachment, textarget, texture, level))
+GLAD_FUNC_VOID(glNamedFramebufferTexture3DEXT, PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (framebuffer, attachment, textarget, texture, level, zoffset))
+GLAD_FUNC_VOID(glNamedFramebufferTextureEXT, PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level))
+GLAD_FUNC_VOID(glNamedFramebufferTextureFaceEXT, PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face), (framebuffer, attachment, texture, level, face))
+GLAD_FUNC_VOID(glNamedFramebufferTextureLayer, PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer))
+GLAD_FUNC_VOID(glNamedFramebufferTextureLayerEXT, PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer))
+GLAD_FUNC_VOID(glNamedFramebufferTextureMultiviewOVR, PFNGLNAMEDFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews), (framebuffer, attachment, texture, level, baseViewIndex, numViews))
+GLAD_FUNC_VOID(glNamedProgramLocalParameter4dEXT, PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC, (GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (program, target, index, x, y, z, w))
+GLAD_FUNC_VOID(glNamedProgramLocalParameter4dvEXT, PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC, (GLuint program, GLenum target, GLuint index, const GLdouble *params), (program, target, index, params))
+GLAD_FUNC_VOID(glNamedProgramLocalParameter4fEXT, PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC, (GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (program, target, index, x, y, z, w))
+GLAD_FUNC_VOID(glNamedProgramLocalParameter4fvEXT, PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC, (GLuint program, GLenum target, GLuint index, const GLfloat *params), (program, target, index, params))
+GLAD_FUNC_VOID(glNamedProgramLocalParameterI4iEXT, PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC, (GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (program, target, index, x, y, z, w))
+GLAD_FUNC_VOID(glNamedProgramLocalParameterI4ivEXT, PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC, (GLuint program, GLenum target, GLuint index, const GLint *params), (program, target, index, params))
+GLAD_FUNC_VOID(glNamedProgramLocalParameterI4uiEXT, PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC, (GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (program, target, index, x, y, z, w))
+GLAD_FUNC_VOID(glNamedProgramLocalParameterI4uivEXT, PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC, (GLuint program, GLenum target, GLuint index, const GLuint *params), (program, target, index, params))
+GLAD_FUNC_VOID(glNamedProgramLocalParameters4fvEXT, PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat *params), (program, target, index, count, params))
+GLAD_FUNC_VOID(glNamedProgramLocalParametersI4ivEXT, PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLint *params), (program, target, index, count, params))
+GLAD_FUNC_VOID(glNamedProgramLocalParametersI4uivEXT, PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint *params), (program, target, index, count, params))
+GLAD_FUNC_VOID(glNamedProgramStringEXT, PFNGLNAMEDPROGRAMSTRINGEXTPROC, (GLuint program, GLenum target, GLenum format, GLsizei len, const void *string), (program, target, format, len, string))
+GLAD_FUNC_VOID(glNamedRenderbufferStorage, PFNGLNAMEDRENDERBUFFERSTORAGEPROC, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height))
+GLAD_FUNC_VOID(glNamedRenderbufferStorageEXT, PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height))
+GLAD_FUNC_VOID(glNamedRenderbufferStorageMultisample, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height))
+GLAD_FUNC_VOID(glNamedRenderbufferStorageMultisampleAdvancedAMD, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC, (GLuint renderbuffer, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, storageSamples, internalformat, width, height))
+GLAD_FUNC_VOID(glNamedRenderbufferStorageMultisampleCoverageEXT, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC, (GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, coverageSamples, colorSamples, internalformat, width, height))
+GLAD_FUNC_VOID(glNamedRenderbufferStorageMultisampleEXT, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height))
+GLAD_FUNC_VOID(glNamedStringARB, PFNGLNAMEDSTRINGARBPROC, (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string), (type, namelen, name, stringlen, string))
+GLAD_FUNC(GLuint, glNewObjectBufferATI, PFNGLNEWOBJECTBUFFERATIPROC, (GLsizei size, const void *pointer, GLenum usage), (size, pointer, usage))
+GLAD_FUNC_VOID(glNormal3fVertex3fSUN, PFNGLNORMAL3FVERTEX3FSUNPROC, (GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (nx, ny, nz, x, y, z))
+GLAD_FUNC_VOID(glNormal3fVertex3fvSUN, PFNGLNORMAL3FVERTEX3FVSUNPROC, (const GLfloat *n, const GLfloat *v), (n, v))
+GLAD_FUNC_VOID(glNormal3hNV, PFNGLNORMAL3HNVPROC, (GLhalfNV nx, GLhalfNV ny, GLhalfNV nz), (nx, ny, nz))
+GLAD_FUNC_VOID(glNormal3hvNV, PFNGLNORMAL3HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glNormal3xOES, PFNGLNORMAL3XOESPROC, (GLfixed nx, GLfixed ny, GLfixed nz), (nx, ny, nz))
+GLAD_FUNC_VOID(glNormal3xvOES, PFNGLNORMAL3XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glNormalFormatNV, PFNGLNORMALFORMATNVPROC, (GLenum type, GLsizei stride), (type, stride))
+GLAD_FUNC_VOID(glNormalP3ui, PFNGLNORMALP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_FUNC_VOID(glNormalP3uiv, PFNGLNORMALP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_FUNC_VOID(glNormalPointerEXT, PFNGLNORMALPOINTEREXTPROC, (GLenum type, GLsizei stride, GLsizei count, const void *pointer), (type, stride, count, pointer))
+GLAD_FUNC_VOID(glNormalPointerListIBM, PFNGLNORMALPOINTERLISTIBMPROC, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride))
+GLAD_FUNC_VOID(glNormalPointervINTEL, PFNGLNORMALPOINTERVINTELPROC, (GLenum type, const void **pointer), (type, pointer))
+GLAD_FUNC_VOID(glNormalStream3bATI, PFNGLNORMALSTREAM3BATIPROC, (GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz), (stream, nx, ny, nz))
+GLAD_FUNC_VOID(glNormalStream3bvATI, PFNGLNORMALSTREAM3BVATIPROC, (GLenum stream, const GLbyte *coords), (stream, coords))
+GLAD_FUNC_VOID(glNormalStream3dATI, PFNGLNORMALSTREAM3DATIPROC, (GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz), (stream, nx, ny, nz))
+GLAD_FUNC_VOID(glNormalStream3dvATI, PFNGLNORMALSTREAM3DVATIPROC, (GLenum stream, const GLdouble *coords), (stream, coords))
+GLAD_FUNC_VOID(glNormalStream3fATI, PFNGLNORMALSTREAM3FATIPROC, (GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz), (stream, nx, ny, nz))
+GLAD_FUNC_VOID(glNormalStream3fvATI, PFNGLNORMALSTREAM3FVATIPROC, (GLenum stream, const GLfloat *coords), (stream, coords))
+GLAD_FUNC_VOID(glNormalStream3iATI, PFNGLNORMALSTREAM3IATIPROC, (GLenum stream, GLint nx, GLint ny, GLint nz), (stream, nx, ny, nz))
+GLAD_FUNC_VOID(glNormalStream3ivATI, PFNGLNORMALSTREAM3IVATIPROC, (GLenum stream, const GLint *coords), (stream, coords))
+GLAD_FUNC_VOID(glNormalStream3sATI, PFNGLNORMALSTREAM3SATIPROC, (GLenum stream, GLshort nx, GLshort ny, GLshort nz), (stream, nx, ny, nz))
+GLAD_FUNC_VOID(glNormalStream3svATI, PFNGLNORMALSTREAM3SVATIPROC, (GLenum stream, const GLshort *coords), (stream, coords))
+GLAD_FUNC_VOID(glObjectLabel, PFNGLOBJECTLABELPROC, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label))
+GLAD_FUNC_VOID(glObjectLabelKHR, PFNGLOBJECTLABELKHRPROC, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label))
+GLAD_FUNC_VOID(glObjectPtrLabel, PFNGLOBJECTPTRLABELPROC, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label))
+GLAD_FUNC_VOID(glObjectPtrLabelKHR, PFNGLOBJECTPTRLABELKHRPROC, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label))
+GLAD_FUNC(GLenum, glObjectPurgeableAPPLE, PFNGLOBJECTPURGEABLEAPPLEPROC, (GLenum objectType, GLuint name, GLenum option), (objectType, name, option))
+GLAD_FUNC(GLenum, glObjectUnpurgeableAPPLE, PFNGLOBJECTUNPURGEABLEAPPLEPROC, (GLenum objectType, GLuint name, GLenum option), (objectType, name, option))
+GLAD_FUNC_VOID(glOrthofOES, PFNGLORTHOFOESPROC, (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f), (l, r, b, t, n, f))
+GLAD_FUNC_VOID(glOrthoxOES, PFNGLORTHOXOESPROC, (GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f), (l, r, b, t, n, f))
+GLAD_FUNC_VOID(glPNTrianglesfATI, PFNGLPNTRIANGLESFATIPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glPNTrianglesiATI, PFNGLPNTRIANGLESIATIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glPassTexCoordATI, PFNGLPASSTEXCOORDATIPROC, (GLuint dst, GLuint coord, GLenum swizzle), (dst, coord, swizzle))
+GLAD_FUNC_VOID(glPassThroughxOES, PFNGLPASSTHROUGHXOESPROC, (GLfixed token), (token))
+GLAD_FUNC_VOID(glPatchParameterfv, PFNGLPATCHPARAMETERFVPROC, (GLenum pname, const GLfloat *values), (pname, values))
+GLAD_FUNC_VOID(glPatchParameteri, PFNGLPATCHPARAMETERIPROC, (GLenum pname, GLint value), (pname, value))
+GLAD_FUNC_VOID(glPathColorGenNV, PFNGLPATHCOLORGENNVPROC, (GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat *coeffs), (color, genMode, colorFormat, coeffs))
+GLAD_FUNC_VOID(glPathCommandsNV, PFNGLPATHCOMMANDSNVPROC, (GLuint path, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords), (path, numCommands, commands, numCoords, coordType, coords))
+GLAD_FUNC_VOID(glPathCoordsNV, PFNGLPATHCOORDSNVPROC, (GLuint path, GLsizei numCoords, GLenum coordType, const void *coords), (path, numCoords, coordType, coords))
+GLAD_FUNC_VOID(glPathCoverDepthFuncNV, PFNGLPATHCOVERDEPTHFUNCNVPROC, (GLenum func), (func))
+GLAD_FUNC_VOID(glPathDashArrayNV, PFNGLPATHDASHARRAYNVPROC, (GLuint path, GLsizei dashCount, const GLfloat *dashArray), (path, dashCount, dashArray))
+GLAD_FUNC_VOID(glPathFogGenNV, PFNGLPATHFOGGENNVPROC, (GLenum genMode), (genMode))
+GLAD_FUNC(GLenum, glPathGlyphIndexArrayNV, PFNGLPATHGLYPHINDEXARRAYNVPROC, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale))
+GLAD_FUNC(GLenum, glPathGlyphIndexRangeNV, PFNGLPATHGLYPHINDEXRANGENVPROC, (GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint *baseAndCount), (fontTarget, fontName, fontStyle, pathParameterTemplate, emScale, baseAndCount))
+GLAD_FUNC_VOID(glPathGlyphRangeNV, PFNGLPATHGLYPHRANGENVPROC, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, firstGlyph, numGlyphs, handleMissingGlyphs, pathParameterTemplate, emScale))
+GLAD_FUNC_VOID(glPathGlyphsNV, PFNGLPATHGLYPHSNVPROC, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void *charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, numGlyphs, type, charcodes, handleMissingGlyphs, pathParameterTemplate, emScale))
+GLAD_FUNC(GLenum, glPathMemoryGlyphIndexArrayNV, PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC, (GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void *fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontSize, fontData, faceIndex, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale))
+GLAD_FUNC_VOID(glPathParameterfNV, PFNGLPATHPARAMETERFNVPROC, (GLuint path, GLenum pname, GLfloat value), (path, pname, value))
+GLAD_FUNC_VOID(glPathParameterfvNV, PFNGLPATHPARAMETERFVNVPROC, (GLuint path, GLenum pname, const GLfloat *value), (path, pname, value))
+GLAD_FUNC_VOID(glPathParameteriNV, PFNGLPATHPARAMETERINVPROC, (GLuint path, GLenum pname, GLint value), (path, pname, value))
+GLAD_FUNC_VOID(glPathParameterivNV, PFNGLPATHPARAMETERIVNVPROC, (GLuint path, GLenum pname, const GLint *value), (path, pname, value))
+GLAD_FUNC_VOID(glPathStencilDepthOffsetNV, PFNGLPATHSTENCILDEPTHOFFSETNVPROC, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_FUNC_VOID(glPathStencilFuncNV, PFNGLPATHSTENCILFUNCNVPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_FUNC_VOID(glPathStringNV, PFNGLPATHSTRINGNVPROC, (GLuint path, GLenum format, GLsizei length, const void *pathString), (path, format, length, pathString))
+GLAD_FUNC_VOID(glPathSubCommandsNV, PFNGLPATHSUBCOMMANDSNVPROC, (GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords), (path, commandStart, commandsToDelete, numCommands, commands, numCoords, coordType, coords))
+GLAD_FUNC_VOID(glPathSubCoordsNV, PFNGLPATHSUBCOORDSNVPROC, (GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords), (path, coordStart, numCoords, coordType, coords))
+GLAD_FUNC_VOID(glPathTexGenNV, PFNGLPATHTEXGENNVPROC, (GLenum texCoordSet, GLenum genMode, GLint components, const GLfloat *coeffs), (texCoordSet, genMode, components, coeffs))
+GLAD_FUNC_VOID(glPauseTransformFeedback, PFNGLPAUSETRANSFORMFEEDBACKPROC, (void), ())
+GLAD_FUNC_VOID(glPauseTransformFeedbackNV, PFNGLPAUSETRANSFORMFEEDBACKNVPROC, (void), ())
+GLAD_FUNC_VOID(glPixelDataRangeNV, PFNGLPIXELDATARANGENVPROC, (GLenum target, GLsizei length, const void *pointer), (target, length, pointer))
+GLAD_FUNC_VOID(glPixelMapx, PFNGLPIXELMAPXPROC, (GLenum map, GLint size, const GLfixed *values), (map, size, values))
+GLAD_FUNC_VOID(glPixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glPixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glPixelStorex, PFNGLPIXELSTOREXPROC, (GLenum pname, GLfixed param), (pname, param))
+GLAD_FUNC_VOID(glPixelTexGenParameterfSGIS, PFNGLPIXELTEXGENPARAMETERFSGISPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glPixelTexGenParameterfvSGIS, PFNGLPIXELTEXGENPARAMETERFVSGISPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glPixelTexGenParameteriSGIS, PFNGLPIXELTEXGENPARAMETERISGISPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glPixelTexGenParameterivSGIS, PFNGLPIXELTEXGENPARAMETERIVSGISPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_FUNC_VOID(glPixelTexGenSGIX, PFNGLPIXELTEXGENSGIXPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glPixelTransferxOES, PFNGLPIXELTRANSFERXOESPROC, (GLenum pname, GLfixed param), (pname, param))
+GLAD_FUNC_VOID(glPixelTransformParameterfEXT, PFNGLPIXELTRANSFORMPARAMETERFEXTPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_FUNC_VOID(glPixelTransformParameterfvEXT, PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glPixelTransformParameteriEXT, PFNGLPIXELTRANSFORMPARAMETERIEXTPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_FUNC_VOID(glPixelTransformParameterivEXT, PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glPixelZoomxOES, PFNGLPIXELZOOMXOESPROC, (GLfixed xfactor, GLfixed yfactor), (xfactor, yfactor))
+GLAD_FUNC(GLboolean, glPointAlongPathNV, PFNGLPOINTALONGPATHNVPROC, (GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY), (path, startSegment, numSegments, distance, x, y, tangentX, tangentY))
+GLAD_FUNC_VOID(glPointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glPointParameterfARB, PFNGLPOINTPARAMETERFARBPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glPointParameterfEXT, PFNGLPOINTPARAMETERFEXTPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glPointParameterfSGIS, PFNGLPOINTPARAMETERFSGISPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glPointParameterfvARB, PFNGLPOINTPARAMETERFVARBPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glPointParameterfvEXT, PFNGLPOINTPARAMETERFVEXTPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glPointParameterfvSGIS, PFNGLPOINTPARAMETERFVSGISPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glPointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glPointParameteriNV, PFNGLPOINTPARAMETERINVPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_FUNC_VOID(glPointParameterivNV, PFNGLPOINTPARAMETERIVNVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_FUNC_VOID(glPointParameterxOES, PFNGLPOINTPARAMETERXOESPROC, (GLenum pname, GLfixed param), (pname, param))
+GLAD_FUNC_VOID(glPointParameterxvOES, PFNGLPOINTPARAMETERXVOESPROC, (GLenum pname, const GLfixed *params), (pname, params))
+GLAD_FUNC_VOID(glPointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size))
+GLAD_FUNC_VOID(glPointSizexOES, PFNGLPOINTSIZEXOESPROC, (GLfixed size), (size))
+GLAD_FUNC(GLint, glPollAsyncSGIX, PFNGLPOLLASYNCSGIXPROC, (GLuint *markerp), (markerp))
+GLAD_FUNC(GLint, glPollInstrumentsSGIX, PFNGLPOLLINSTRUMENTSSGIXPROC, (GLint *marker_p), (marker_p))
+GLAD_FUNC_VOID(glPolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_FUNC_VOID(glPolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_FUNC_VOID(glPolygonOffsetClamp, PFNGLPOLYGONOFFSETCLAMPPROC, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp))
+GLAD_FUNC_VOID(glPolygonOffsetClampEXT, PFNGLPOLYGONOFFSETCLAMPEXTPROC, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp))
+GLAD_FUNC_VOID(glPolygonOffsetEXT, PFNGLPOLYGONOFFSETEXTPROC, (GLfloat factor, GLfloat bias), (factor, bias))
+GLAD_FUNC_VOID(glPolygonOffsetxOES, PFNGLPOLYGONOFFSETXOESPROC, (GLfixed factor, GLfixed units), (factor, units))
+GLAD_FUNC_VOID(glPopDebugGroup, PFNGLPOPDEBUGGROUPPROC, (void), ())
+GLAD_FUNC_VOID(glPopDebugGroupKHR, PFNGLPOPDEBUGGROUPKHRPROC, (void), ())
+GLAD_FUNC_VOID(glPopGroupMarkerEXT, PFNGLPOPGROUPMARKEREXTPROC, (void), ())
+GLAD_FUNC_VOID(glPresentFrameDualFillNV, PFNGLPRESENTFRAMEDUALFILLNVPROC, (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3), (video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, target1, fill1, target2, fill2, target3, fill3))
+GLAD_FUNC_VOID(glPresentFrameKeyedNV, PFNGLPRESENTFRAMEKEYEDNVPROC, (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1), (video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, key0, target1, fill1, key1))
+GLAD_FUNC_VOID(glPrimitiveBoundingBoxARB, PFNGLPRIMITIVEBOUNDINGBOXARBPROC, (GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW), (minX, minY, minZ, minW, maxX, maxY, maxZ, maxW))
+GLAD_FUNC_VOID(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index))
+GLAD_FUNC_VOID(glPrimitiveRestartIndexNV, PFNGLPRIMITIVERESTARTINDEXNVPROC, (GLuint index), (index))
+GLAD_FUNC_VOID(glPrimitiveRestartNV, PFNGLPRIMITIVERESTARTNVPROC, (void), ())
+GLAD_FUNC_VOID(glPrioritizeTexturesEXT, PFNGLPRIORITIZETEXTURESEXTPROC, (GLsizei n, const GLuint *textures, const GLclampf *priorities), (n, textures, priorities))
+GLAD_FUNC_VOID(glPrioritizeTexturesxOES, PFNGLPRIORITIZETEXTURESXOESPROC, (GLsizei n, const GLuint *textures, const GLfixed *priorities), (n, textures, priorities))
+GLAD_FUNC_VOID(glProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GLAD_FUNC_VOID(glProgramBufferParametersIivNV, PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLint *params), (target, bindingIndex, wordIndex, count, params))
+GLAD_FUNC_VOID(glProgramBufferParametersIuivNV, PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLuint *params), (target, bindingIndex, wordIndex, count, params))
+GLAD_FUNC_VOID(glProgramBufferParametersfvNV, PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLfloat *params), (target, bindingIndex, wordIndex, count, params))
+GLAD_FUNC_VOID(glProgramEnvParameter4dARB, PFNGLPROGRAMENVPARAMETER4DARBPROC, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramEnvParameter4dvARB, PFNGLPROGRAMENVPARAMETER4DVARBPROC, (GLenum target, GLuint index, const GLdouble *params), (target, index, params))
+GLAD_FUNC_VOID(glProgramEnvParameter4fARB, PFNGLPROGRAMENVPARAMETER4FARBPROC, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramEnvParameter4fvARB, PFNGLPROGRAMENVPARAMETER4FVARBPROC, (GLenum target, GLuint index, const GLfloat *params), (target, index, params))
+GLAD_FUNC_VOID(glProgramEnvParameterI4iNV, PFNGLPROGRAMENVPARAMETERI4INVPROC, (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramEnvParameterI4ivNV, PFNGLPROGRAMENVPARAMETERI4IVNVPROC, (GLenum target, GLuint index, const GLint *params), (target, index, params))
+GLAD_FUNC_VOID(glProgramEnvParameterI4uiNV, PFNGLPROGRAMENVPARAMETERI4UINVPROC, (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramEnvParameterI4uivNV, PFNGLPROGRAMENVPARAMETERI4UIVNVPROC, (GLenum target, GLuint index, const GLuint *params), (target, index, params))
+GLAD_FUNC_VOID(glProgramEnvParameters4fvEXT, PFNGLPROGRAMENVPARAMETERS4FVEXTPROC, (GLenum target, GLuint index, GLsizei count, const GLfloat *params), (target, index, count, params))
+GLAD_FUNC_VOID(glProgramEnvParametersI4ivNV, PFNGLPROGRAMENVPARAMETERSI4IVNVPROC, (GLenum target, GLuint index, GLsizei count, const GLint *params), (target, index, count, params))
+GLAD_FUNC_VOID(glProgramEnvParametersI4uivNV, PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC, (GLenum target, GLuint index, GLsizei count, const GLuint *params), (target, index, count, params))
+GLAD_FUNC_VOID(glProgramLocalParameter4dARB, PFNGLPROGRAMLOCALPARAMETER4DARBPROC, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramLocalParameter4dvARB, PFNGLPROGRAMLOCALPARAMETER4DVARBPROC, (GLenum target, GLuint index, const GLdouble *params), (target, index, params))
+GLAD_FUNC_VOID(glProgramLocalParameter4fARB, PFNGLPROGRAMLOCALPARAMETER4FARBPROC, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramLocalParameter4fvARB, PFNGLPROGRAMLOCALPARAMETER4FVARBPROC, (GLenum target, GLuint index, const GLfloat *params), (target, index, params))
+GLAD_FUNC_VOID(glProgramLocalParameterI4iNV, PFNGLPROGRAMLOCALPARAMETERI4INVPROC, (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramLocalParameterI4ivNV, PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC, (GLenum target, GLuint index, const GLint *params), (target, index, params))
+GLAD_FUNC_VOID(glProgramLocalParameterI4uiNV, PFNGLPROGRAMLOCALPARAMETERI4UINVPROC, (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramLocalParameterI4uivNV, PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC, (GLenum target, GLuint index, const GLuint *params), (target, index, params))
+GLAD_FUNC_VOID(glProgramLocalParameters4fvEXT, PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC, (GLenum target, GLuint index, GLsizei count, const GLfloat *params), (target, index, count, params))
+GLAD_FUNC_VOID(glProgramLocalParametersI4ivNV, PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC, (GLenum target, GLuint index, GLsizei count, const GLint *params), (target, index, count, params))
+GLAD_FUNC_VOID(glProgramLocalParametersI4uivNV, PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC, (GLenum target, GLuint index, GLsizei count, const GLuint *params), (target, index, count, params))
+GLAD_FUNC_VOID(glProgramNamedParameter4dNV, PFNGLPROGRAMNAMEDPARAMETER4DNVPROC, (GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (id, len, name, x, y, z, w))
+GLAD_FUNC_VOID(glProgramNamedParameter4dvNV, PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC, (GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v), (id, len, name, v))
+GLAD_FUNC_VOID(glProgramNamedParameter4fNV, PFNGLPROGRAMNAMEDPARAMETER4FNVPROC, (GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (id, len, name, x, y, z, w))
+GLAD_FUNC_VOID(glProgramNamedParameter4fvNV, PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC, (GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v), (id, len, name, v))
+GLAD_FUNC_VOID(glProgramParameter4dNV, PFNGLPROGRAMPARAMETER4DNVPROC, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramParameter4dvNV, PFNGLPROGRAMPARAMETER4DVNVPROC, (GLenum target, GLuint index, const GLdouble *v), (target, index, v))
+GLAD_FUNC_VOID(glProgramParameter4fNV, PFNGLPROGRAMPARAMETER4FNVPROC, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w))
+GLAD_FUNC_VOID(glProgramParameter4fvNV, PFNGLPROGRAMPARAMETER4FVNVPROC, (GLenum target, GLuint index, const GLfloat *v), (target, index, v))
+GLAD_FUNC_VOID(glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_FUNC_VOID(glProgramParameteriARB, PFNGLPROGRAMPARAMETERIARBPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_FUNC_VOID(glProgramParameteriEXT, PFNGLPROGRAMPARAMETERIEXTPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_FUNC_VOID(glProgramParameters4dvNV, PFNGLPROGRAMPARAMETERS4DVNVPROC, (GLenum target, GLuint index, GLsizei count, const GLdouble *v), (target, index, count, v))
+GLAD_FUNC_VOID(glProgramParameters4fvNV, PFNGLPROGRAMPARAMETERS4FVNVPROC, (GLenum target, GLuint index, GLsizei count, const GLfloat *v), (target, index, count, v))
+GLAD_FUNC_VOID(glProgramPathFragmentInputGenNV, PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC, (GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat *coeffs), (program, location, genMode, components, coeffs))
+GLAD_FUNC_VOID(glProgramStringARB, PFNGLPROGRAMSTRINGARBPROC, (GLenum target, GLenum format, GLsizei len, const void *string), (target, format, len, string))
+GLAD_FUNC_VOID(glProgramSubroutineParametersuivNV, PFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC, (GLenum target, GLsizei count, const GLuint *params), (target, count, params))
+GLAD_FUNC_VOID(glProgramUniform1d, PFNGLPROGRAMUNIFORM1DPROC, (GLuint program, GLint location, GLdouble v0), (program, location, v0))
+GLAD_FUNC_VOID(glProgramUniform1dEXT, PFNGLPROGRAMUNIFORM1DEXTPROC, (GLuint program, GLint location, GLdouble x), (program, location, x))
+GLAD_FUNC_VOID(glProgramUniform1dv, PFNGLPROGRAMUNIFORM1DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1dvEXT, PFNGLPROGRAMUNIFORM1DVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1f, PFNGLPROGRAMUNIFORM1FPROC, (GLuint program, GLint location, GLfloat v0), (program, location, v0))
+GLAD_FUNC_VOID(glProgramUniform1fEXT, PFNGLPROGRAMUNIFORM1FEXTPROC, (GLuint program, GLint location, GLfloat v0), (program, location, v0))
+GLAD_FUNC_VOID(glProgramUniform1fv, PFNGLPROGRAMUNIFORM1FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1fvEXT, PFNGLPROGRAMUNIFORM1FVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1i, PFNGLPROGRAMUNIFORM1IPROC, (GLuint program, GLint location, GLint v0), (program, location, v0))
+GLAD_FUNC_VOID(glProgramUniform1i64ARB, PFNGLPROGRAMUNIFORM1I64ARBPROC, (GLuint program, GLint location, GLint64 x), (program, location, x))
+GLAD_FUNC_VOID(glProgramUniform1i64NV, PFNGLPROGRAMUNIFORM1I64NVPROC, (GLuint program, GLint location, GLint64EXT x), (program, location, x))
+GLAD_FUNC_VOID(glProgramUniform1i64vARB, PFNGLPROGRAMUNIFORM1I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1i64vNV, PFNGLPROGRAMUNIFORM1I64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1iEXT, PFNGLPROGRAMUNIFORM1IEXTPROC, (GLuint program, GLint location, GLint v0), (program, location, v0))
+GLAD_FUNC_VOID(glProgramUniform1iv, PFNGLPROGRAMUNIFORM1IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1ivEXT, PFNGLPROGRAMUNIFORM1IVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1ui, PFNGLPROGRAMUNIFORM1UIPROC, (GLuint program, GLint location, GLuint v0), (program, location, v0))
+GLAD_FUNC_VOID(glProgramUniform1ui64ARB, PFNGLPROGRAMUNIFORM1UI64ARBPROC, (GLuint program, GLint location, GLuint64 x), (program, location, x))
+GLAD_FUNC_VOID(glProgramUniform1ui64NV, PFNGLPROGRAMUNIFORM1UI64NVPROC, (GLuint program, GLint location, GLuint64EXT x), (program, location, x))
+GLAD_FUNC_VOID(glProgramUniform1ui64vARB, PFNGLPROGRAMUNIFORM1UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1ui64vNV, PFNGLPROGRAMUNIFORM1UI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1uiEXT, PFNGLPROGRAMUNIFORM1UIEXTPROC, (GLuint program, GLint location, GLuint v0), (program, location, v0))
+GLAD_FUNC_VOID(glProgramUniform1uiv, PFNGLPROGRAMUNIFORM1UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform1uivEXT, PFNGLPROGRAMUNIFORM1UIVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2d, PFNGLPROGRAMUNIFORM2DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1))
+GLAD_FUNC_VOID(glProgramUniform2dEXT, PFNGLPROGRAMUNIFORM2DEXTPROC, (GLuint program, GLint location, GLdouble x, GLdouble y), (program, location, x, y))
+GLAD_FUNC_VOID(glProgramUniform2dv, PFNGLPROGRAMUNIFORM2DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2dvEXT, PFNGLPROGRAMUNIFORM2DVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2f, PFNGLPROGRAMUNIFORM2FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1))
+GLAD_FUNC_VOID(glProgramUniform2fEXT, PFNGLPROGRAMUNIFORM2FEXTPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1))
+GLAD_FUNC_VOID(glProgramUniform2fv, PFNGLPROGRAMUNIFORM2FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2fvEXT, PFNGLPROGRAMUNIFORM2FVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2i, PFNGLPROGRAMUNIFORM2IPROC, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1))
+GLAD_FUNC_VOID(glProgramUniform2i64ARB, PFNGLPROGRAMUNIFORM2I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y), (program, location, x, y))
+GLAD_FUNC_VOID(glProgramUniform2i64NV, PFNGLPROGRAMUNIFORM2I64NVPROC, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y), (program, location, x, y))
+GLAD_FUNC_VOID(glProgramUniform2i64vARB, PFNGLPROGRAMUNIFORM2I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2i64vNV, PFNGLPROGRAMUNIFORM2I64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2iEXT, PFNGLPROGRAMUNIFORM2IEXTPROC, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1))
+GLAD_FUNC_VOID(glProgramUniform2iv, PFNGLPROGRAMUNIFORM2IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2ivEXT, PFNGLPROGRAMUNIFORM2IVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2ui, PFNGLPROGRAMUNIFORM2UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1))
+GLAD_FUNC_VOID(glProgramUniform2ui64ARB, PFNGLPROGRAMUNIFORM2UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y), (program, location, x, y))
+GLAD_FUNC_VOID(glProgramUniform2ui64NV, PFNGLPROGRAMUNIFORM2UI64NVPROC, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y), (program, location, x, y))
+GLAD_FUNC_VOID(glProgramUniform2ui64vARB, PFNGLPROGRAMUNIFORM2UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2ui64vNV, PFNGLPROGRAMUNIFORM2UI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2uiEXT, PFNGLPROGRAMUNIFORM2UIEXTPROC, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1))
+GLAD_FUNC_VOID(glProgramUniform2uiv, PFNGLPROGRAMUNIFORM2UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform2uivEXT, PFNGLPROGRAMUNIFORM2UIVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3d, PFNGLPROGRAMUNIFORM3DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2))
+GLAD_FUNC_VOID(glProgramUniform3dEXT, PFNGLPROGRAMUNIFORM3DEXTPROC, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z), (program, location, x, y, z))
+GLAD_FUNC_VOID(glProgramUniform3dv, PFNGLPROGRAMUNIFORM3DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3dvEXT, PFNGLPROGRAMUNIFORM3DVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3f, PFNGLPROGRAMUNIFORM3FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2))
+GLAD_FUNC_VOID(glProgramUniform3fEXT, PFNGLPROGRAMUNIFORM3FEXTPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2))
+GLAD_FUNC_VOID(glProgramUniform3fv, PFNGLPROGRAMUNIFORM3FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3fvEXT, PFNGLPROGRAMUNIFORM3FVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3i, PFNGLPROGRAMUNIFORM3IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2))
+GLAD_FUNC_VOID(glProgramUniform3i64ARB, PFNGLPROGRAMUNIFORM3I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z), (program, location, x, y, z))
+GLAD_FUNC_VOID(glProgramUniform3i64NV, PFNGLPROGRAMUNIFORM3I64NVPROC, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z), (program, location, x, y, z))
+GLAD_FUNC_VOID(glProgramUniform3i64vARB, PFNGLPROGRAMUNIFORM3I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3i64vNV, PFNGLPROGRAMUNIFORM3I64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3iEXT, PFNGLPROGRAMUNIFORM3IEXTPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2))
+GLAD_FUNC_VOID(glProgramUniform3iv, PFNGLPROGRAMUNIFORM3IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3ivEXT, PFNGLPROGRAMUNIFORM3IVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3ui, PFNGLPROGRAMUNIFORM3UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2))
+GLAD_FUNC_VOID(glProgramUniform3ui64ARB, PFNGLPROGRAMUNIFORM3UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (program, location, x, y, z))
+GLAD_FUNC_VOID(glProgramUniform3ui64NV, PFNGLPROGRAMUNIFORM3UI64NVPROC, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (program, location, x, y, z))
+GLAD_FUNC_VOID(glProgramUniform3ui64vARB, PFNGLPROGRAMUNIFORM3UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3ui64vNV, PFNGLPROGRAMUNIFORM3UI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3uiEXT, PFNGLPROGRAMUNIFORM3UIEXTPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2))
+GLAD_FUNC_VOID(glProgramUniform3uiv, PFNGLPROGRAMUNIFORM3UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform3uivEXT, PFNGLPROGRAMUNIFORM3UIVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4d, PFNGLPROGRAMUNIFORM4DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glProgramUniform4dEXT, PFNGLPROGRAMUNIFORM4DEXTPROC, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (program, location, x, y, z, w))
+GLAD_FUNC_VOID(glProgramUniform4dv, PFNGLPROGRAMUNIFORM4DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4dvEXT, PFNGLPROGRAMUNIFORM4DVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4f, PFNGLPROGRAMUNIFORM4FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glProgramUniform4fEXT, PFNGLPROGRAMUNIFORM4FEXTPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glProgramUniform4fv, PFNGLPROGRAMUNIFORM4FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4fvEXT, PFNGLPROGRAMUNIFORM4FVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4i, PFNGLPROGRAMUNIFORM4IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glProgramUniform4i64ARB, PFNGLPROGRAMUNIFORM4I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (program, location, x, y, z, w))
+GLAD_FUNC_VOID(glProgramUniform4i64NV, PFNGLPROGRAMUNIFORM4I64NVPROC, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (program, location, x, y, z, w))
+GLAD_FUNC_VOID(glProgramUniform4i64vARB, PFNGLPROGRAMUNIFORM4I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4i64vNV, PFNGLPROGRAMUNIFORM4I64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4iEXT, PFNGLPROGRAMUNIFORM4IEXTPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glProgramUniform4iv, PFNGLPROGRAMUNIFORM4IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4ivEXT, PFNGLPROGRAMUNIFORM4IVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4ui, PFNGLPROGRAMUNIFORM4UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glProgramUniform4ui64ARB, PFNGLPROGRAMUNIFORM4UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (program, location, x, y, z, w))
+GLAD_FUNC_VOID(glProgramUniform4ui64NV, PFNGLPROGRAMUNIFORM4UI64NVPROC, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (program, location, x, y, z, w))
+GLAD_FUNC_VOID(glProgramUniform4ui64vARB, PFNGLPROGRAMUNIFORM4UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4ui64vNV, PFNGLPROGRAMUNIFORM4UI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4uiEXT, PFNGLPROGRAMUNIFORM4UIEXTPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glProgramUniform4uiv, PFNGLPROGRAMUNIFORM4UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniform4uivEXT, PFNGLPROGRAMUNIFORM4UIVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramUniformHandleui64ARB, PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC, (GLuint program, GLint location, GLuint64 value), (program, location, value))
+GLAD_FUNC_VOID(glProgramUniformHandleui64NV, PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC, (GLuint program, GLint location, GLuint64 value), (program, location, value))
+GLAD_FUNC_VOID(glProgramUniformHandleui64vARB, PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values))
+GLAD_FUNC_VOID(glProgramUniformHandleui64vNV, PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values))
+GLAD_FUNC_VOID(glProgramUniformMatrix2dv, PFNGLPROGRAMUNIFORMMATRIX2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2dvEXT, PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2fv, PFNGLPROGRAMUNIFORMMATRIX2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2fvEXT, PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2x3dv, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2x3dvEXT, PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2x3fv, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2x3fvEXT, PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2x4dv, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2x4dvEXT, PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2x4fv, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix2x4fvEXT, PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3dv, PFNGLPROGRAMUNIFORMMATRIX3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3dvEXT, PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3fv, PFNGLPROGRAMUNIFORMMATRIX3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3fvEXT, PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3x2dv, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3x2dvEXT, PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3x2fv, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3x2fvEXT, PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3x4dv, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3x4dvEXT, PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3x4fv, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix3x4fvEXT, PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4dv, PFNGLPROGRAMUNIFORMMATRIX4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4dvEXT, PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4fv, PFNGLPROGRAMUNIFORMMATRIX4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4fvEXT, PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4x2dv, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4x2dvEXT, PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4x2fv, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4x2fvEXT, PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4x3dv, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4x3dvEXT, PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4x3fv, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformMatrix4x3fvEXT, PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_FUNC_VOID(glProgramUniformui64NV, PFNGLPROGRAMUNIFORMUI64NVPROC, (GLuint program, GLint location, GLuint64EXT value), (program, location, value))
+GLAD_FUNC_VOID(glProgramUniformui64vNV, PFNGLPROGRAMUNIFORMUI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GLAD_FUNC_VOID(glProgramVertexLimitNV, PFNGLPROGRAMVERTEXLIMITNVPROC, (GLenum target, GLint limit), (target, limit))
+GLAD_FUNC_VOID(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glProvokingVertexEXT, PFNGLPROVOKINGVERTEXEXTPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glPushClientAttribDefaultEXT, PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC, (GLbitfield mask), (mask))
+GLAD_FUNC_VOID(glPushDebugGroup, PFNGLPUSHDEBUGGROUPPROC, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message))
+GLAD_FUNC_VOID(glPushDebugGroupKHR, PFNGLPUSHDEBUGGROUPKHRPROC, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message))
+GLAD_FUNC_VOID(glPushGroupMarkerEXT, PFNGLPUSHGROUPMARKEREXTPROC, (GLsizei length, const GLchar *marker), (length, marker))
+GLAD_FUNC_VOID(glQueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target))
+GLAD_FUNC(GLbitfield, glQueryMatrixxOES, PFNGLQUERYMATRIXXOESPROC, (GLfixed *mantissa, GLint *exponent), (mantissa, exponent))
+GLAD_FUNC_VOID(glQueryObjectParameteruiAMD, PFNGLQUERYOBJECTPARAMETERUIAMDPROC, (GLenum target, GLuint id, GLenum pname, GLuint param), (target, id, pname, param))
+GLAD_FUNC(GLint, glQueryResourceNV, PFNGLQUERYRESOURCENVPROC, (GLenum queryType, GLint tagId, GLuint count, GLint *buffer), (queryType, tagId, count, buffer))
+GLAD_FUNC_VOID(glQueryResourceTagNV, PFNGLQUERYRESOURCETAGNVPROC, (GLint tagId, const GLchar *tagString), (tagId, tagString))
+GLAD_FUNC_VOID(glRasterPos2xOES, PFNGLRASTERPOS2XOESPROC, (GLfixed x, GLfixed y), (x, y))
+GLAD_FUNC_VOID(glRasterPos2xvOES, PFNGLRASTERPOS2XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glRasterPos3xOES, PFNGLRASTERPOS3XOESPROC, (GLfixed x, GLfixed y, GLfixed z), (x, y, z))
+GLAD_FUNC_VOID(glRasterPos3xvOES, PFNGLRASTERPOS3XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glRasterPos4xOES, PFNGLRASTERPOS4XOESPROC, (GLfixed x, GLfixed y, GLfixed z, GLfixed w), (x, y, z, w))
+GLAD_FUNC_VOID(glRasterPos4xvOES, PFNGLRASTERPOS4XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glRasterSamplesEXT, PFNGLRASTERSAMPLESEXTPROC, (GLuint samples, GLboolean fixedsamplelocations), (samples, fixedsamplelocations))
+GLAD_FUNC_VOID(glReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src))
+GLAD_FUNC_VOID(glReadInstrumentsSGIX, PFNGLREADINSTRUMENTSSGIXPROC, (GLint marker), (marker))
+GLAD_FUNC_VOID(glReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GLAD_FUNC_VOID(glReadnPixels, PFNGLREADNPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data))
+GLAD_FUNC_VOID(glReadnPixelsARB, PFNGLREADNPIXELSARBPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data))
+GLAD_FUNC_VOID(glReadnPixelsKHR, PFNGLREADNPIXELSKHRPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data))
+GLAD_FUNC_VOID(glRectxOES, PFNGLRECTXOESPROC, (GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2), (x1, y1, x2, y2))
+GLAD_FUNC_VOID(glRectxvOES, PFNGLRECTXVOESPROC, (const GLfixed *v1, const GLfixed *v2), (v1, v2))
+GLAD_FUNC_VOID(glReferencePlaneSGIX, PFNGLREFERENCEPLANESGIXPROC, (const GLdouble *equation), (equation))
+GLAD_FUNC(GLboolean, glReleaseKeyedMutexWin32EXT, PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC, (GLuint memory, GLuint64 key), (memory, key))
+GLAD_FUNC_VOID(glReleaseShaderCompiler, PFNGLRELEASESHADERCOMPILERPROC, (void), ())
+GLAD_FUNC_VOID(glRenderGpuMaskNV, PFNGLRENDERGPUMASKNVPROC, (GLbitfield mask), (mask))
+GLAD_FUNC_VOID(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_FUNC_VOID(glRenderbufferStorageEXT, PFNGLRENDERBUFFERSTORAGEEXTPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_FUNC_VOID(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_FUNC_VOID(glRenderbufferStorageMultisampleAdvancedAMD, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC, (GLenum target, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, storageSamples, internalformat, width, height))
+GLAD_FUNC_VOID(glRenderbufferStorageMultisampleCoverageNV, PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height), (target, coverageSamples, colorSamples, internalformat, width, height))
+GLAD_FUNC_VOID(glRenderbufferStorageMultisampleEXT, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_FUNC_VOID(glReplacementCodePointerSUN, PFNGLREPLACEMENTCODEPOINTERSUNPROC, (GLenum type, GLsizei stride, const void **pointer), (type, stride, pointer))
+GLAD_FUNC_VOID(glReplacementCodeubSUN, PFNGLREPLACEMENTCODEUBSUNPROC, (GLubyte code), (code))
+GLAD_FUNC_VOID(glReplacementCodeubvSUN, PFNGLREPLACEMENTCODEUBVSUNPROC, (const GLubyte *code), (code))
+GLAD_FUNC_VOID(glReplacementCodeuiColor3fVertex3fSUN, PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC, (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, x, y, z))
+GLAD_FUNC_VOID(glReplacementCodeuiColor3fVertex3fvSUN, PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC, (const GLuint *rc, const GLfloat *c, const GLfloat *v), (rc, c, v))
+GLAD_FUNC_VOID(glReplacementCodeuiColor4fNormal3fVertex3fSUN, PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC, (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, a, nx, ny, nz, x, y, z))
+GLAD_FUNC_VOID(glReplacementCodeuiColor4fNormal3fVertex3fvSUN, PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC, (const GLuint *rc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (rc, c, n, v))
+GLAD_FUNC_VOID(glReplacementCodeuiColor4ubVertex3fSUN, PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC, (GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, a, x, y, z))
+GLAD_FUNC_VOID(glReplacementCodeuiColor4ubVertex3fvSUN, PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC, (const GLuint *rc, const GLubyte *c, const GLfloat *v), (rc, c, v))
+GLAD_FUNC_VOID(glReplacementCodeuiNormal3fVertex3fSUN, PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC, (GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, nx, ny, nz, x, y, z))
+GLAD_FUNC_VOID(glReplacementCodeuiNormal3fVertex3fvSUN, PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC, (const GLuint *rc, const GLfloat *n, const GLfloat *v), (rc, n, v))
+GLAD_FUNC_VOID(glReplacementCodeuiSUN, PFNGLREPLACEMENTCODEUISUNPROC, (GLuint code), (code))
+GLAD_FUNC_VOID(glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC, (GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, r, g, b, a, nx, ny, nz, x, y, z))
+GLAD_FUNC_VOID(glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN, PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC, (const GLuint *rc, const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (rc, tc, c, n, v))
+GLAD_FUNC_VOID(glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC, (GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, nx, ny, nz, x, y, z))
+GLAD_FUNC_VOID(glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN, PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC, (const GLuint *rc, const GLfloat *tc, const GLfloat *n, const GLfloat *v), (rc, tc, n, v))
+GLAD_FUNC_VOID(glReplacementCodeuiTexCoord2fVertex3fSUN, PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC, (GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, x, y, z))
+GLAD_FUNC_VOID(glReplacementCodeuiTexCoord2fVertex3fvSUN, PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC, (const GLuint *rc, const GLfloat *tc, const GLfloat *v), (rc, tc, v))
+GLAD_FUNC_VOID(glReplacementCodeuiVertex3fSUN, PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC, (GLuint rc, GLfloat x, GLfloat y, GLfloat z), (rc, x, y, z))
+GLAD_FUNC_VOID(glReplacementCodeuiVertex3fvSUN, PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC, (const GLuint *rc, const GLfloat *v), (rc, v))
+GLAD_FUNC_VOID(glReplacementCodeuivSUN, PFNGLREPLACEMENTCODEUIVSUNPROC, (const GLuint *code), (code))
+GLAD_FUNC_VOID(glReplacementCodeusSUN, PFNGLREPLACEMENTCODEUSSUNPROC, (GLushort code), (code))
+GLAD_FUNC_VOID(glReplacementCodeusvSUN, PFNGLREPLACEMENTCODEUSVSUNPROC, (const GLushort *code), (code))
+GLAD_FUNC_VOID(glRequestResidentProgramsNV, PFNGLREQUESTRESIDENTPROGRAMSNVPROC, (GLsizei n, const GLuint *programs), (n, programs))
+GLAD_FUNC_VOID(glResetHistogram, PFNGLRESETHISTOGRAMPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glResetHistogramEXT, PFNGLRESETHISTOGRAMEXTPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glResetMemoryObjectParameterNV, PFNGLRESETMEMORYOBJECTPARAMETERNVPROC, (GLuint memory, GLenum pname), (memory, pname))
+GLAD_FUNC_VOID(glResetMinmax, PFNGLRESETMINMAXPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glResetMinmaxEXT, PFNGLRESETMINMAXEXTPROC, (GLenum target), (target))
+GLAD_FUNC_VOID(glResizeBuffersMESA, PFNGLRESIZEBUFFERSMESAPROC, (void), ())
+GLAD_FUNC_VOID(glResolveDepthValuesNV, PFNGLRESOLVEDEPTHVALUESNVPROC, (void), ())
+GLAD_FUNC_VOID(glResumeTransformFeedback, PFNGLRESUMETRANSFORMFEEDBACKPROC, (void), ())
+GLAD_FUNC_VOID(glResumeTransformFeedbackNV, PFNGLRESUMETRANSFORMFEEDBACKNVPROC, (void), ())
+GLAD_FUNC_VOID(glRotatexOES, PFNGLROTATEXOESPROC, (GLfixed angle, GLfixed x, GLfixed y, GLfixed z), (angle, x, y, z))
+GLAD_FUNC_VOID(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_FUNC_VOID(glSampleCoverageARB, PFNGLSAMPLECOVERAGEARBPROC, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_FUNC_VOID(glSampleCoveragexOES, PFNGLSAMPLECOVERAGEXOESPROC, (GLclampx value, GLboolean invert), (value, invert))
+GLAD_FUNC_VOID(glSampleMapATI, PFNGLSAMPLEMAPATIPROC, (GLuint dst, GLuint interp, GLenum swizzle), (dst, interp, swizzle))
+GLAD_FUNC_VOID(glSampleMaskEXT, PFNGLSAMPLEMASKEXTPROC, (GLclampf value, GLboolean invert), (value, invert))
+GLAD_FUNC_VOID(glSampleMaskIndexedNV, PFNGLSAMPLEMASKINDEXEDNVPROC, (GLuint index, GLbitfield mask), (index, mask))
+GLAD_FUNC_VOID(glSampleMaskSGIS, PFNGLSAMPLEMASKSGISPROC, (GLclampf value, GLboolean invert), (value, invert))
+GLAD_FUNC_VOID(glSampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GLAD_FUNC_VOID(glSamplePatternEXT, PFNGLSAMPLEPATTERNEXTPROC, (GLenum pattern), (pattern))
+GLAD_FUNC_VOID(glSamplePatternSGIS, PFNGLSAMPLEPATTERNSGISPROC, (GLenum pattern), (pattern))
+GLAD_FUNC_VOID(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_FUNC_VOID(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GLAD_FUNC_VOID(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GLAD_FUNC_VOID(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GLAD_FUNC_VOID(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GLAD_FUNC_VOID(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_FUNC_VOID(glScalexOES, PFNGLSCALEXOESPROC, (GLfixed x, GLfixed y, GLfixed z), (x, y, z))
+GLAD_FUNC_VOID(glScissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_FUNC_VOID(glScissorArrayv, PFNGLSCISSORARRAYVPROC, (GLuint first, GLsizei count, const GLint *v), (first, count, v))
+GLAD_FUNC_VOID(glScissorExclusiveArrayvNV, PFNGLSCISSOREXCLUSIVEARRAYVNVPROC, (GLuint first, GLsizei count, const GLint *v), (first, count, v))
+GLAD_FUNC_VOID(glScissorExclusiveNV, PFNGLSCISSOREXCLUSIVENVPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_FUNC_VOID(glScissorIndexed, PFNGLSCISSORINDEXEDPROC, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height))
+GLAD_FUNC_VOID(glScissorIndexedv, PFNGLSCISSORINDEXEDVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glSecondaryColor3bEXT, PFNGLSECONDARYCOLOR3BEXTPROC, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3bvEXT, PFNGLSECONDARYCOLOR3BVEXTPROC, (const GLbyte *v), (v))
+GLAD_FUNC_VOID(glSecondaryColor3dEXT, PFNGLSECONDARYCOLOR3DEXTPROC, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3dvEXT, PFNGLSECONDARYCOLOR3DVEXTPROC, (const GLdouble *v), (v))
+GLAD_FUNC_VOID(glSecondaryColor3fEXT, PFNGLSECONDARYCOLOR3FEXTPROC, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3fvEXT, PFNGLSECONDARYCOLOR3FVEXTPROC, (const GLfloat *v), (v))
+GLAD_FUNC_VOID(glSecondaryColor3hNV, PFNGLSECONDARYCOLOR3HNVPROC, (GLhalfNV red, GLhalfNV green, GLhalfNV blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3hvNV, PFNGLSECONDARYCOLOR3HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glSecondaryColor3iEXT, PFNGLSECONDARYCOLOR3IEXTPROC, (GLint red, GLint green, GLint blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3ivEXT, PFNGLSECONDARYCOLOR3IVEXTPROC, (const GLint *v), (v))
+GLAD_FUNC_VOID(glSecondaryColor3sEXT, PFNGLSECONDARYCOLOR3SEXTPROC, (GLshort red, GLshort green, GLshort blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3svEXT, PFNGLSECONDARYCOLOR3SVEXTPROC, (const GLshort *v), (v))
+GLAD_FUNC_VOID(glSecondaryColor3ubEXT, PFNGLSECONDARYCOLOR3UBEXTPROC, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3ubvEXT, PFNGLSECONDARYCOLOR3UBVEXTPROC, (const GLubyte *v), (v))
+GLAD_FUNC_VOID(glSecondaryColor3uiEXT, PFNGLSECONDARYCOLOR3UIEXTPROC, (GLuint red, GLuint green, GLuint blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3uivEXT, PFNGLSECONDARYCOLOR3UIVEXTPROC, (const GLuint *v), (v))
+GLAD_FUNC_VOID(glSecondaryColor3usEXT, PFNGLSECONDARYCOLOR3USEXTPROC, (GLushort red, GLushort green, GLushort blue), (red, green, blue))
+GLAD_FUNC_VOID(glSecondaryColor3usvEXT, PFNGLSECONDARYCOLOR3USVEXTPROC, (const GLushort *v), (v))
+GLAD_FUNC_VOID(glSecondaryColorFormatNV, PFNGLSECONDARYCOLORFORMATNVPROC, (GLint size, GLenum type, GLsizei stride), (size, type, stride))
+GLAD_FUNC_VOID(glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_FUNC_VOID(glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_FUNC_VOID(glSecondaryColorPointerEXT, PFNGLSECONDARYCOLORPOINTEREXTPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_FUNC_VOID(glSecondaryColorPointerListIBM, PFNGLSECONDARYCOLORPOINTERLISTIBMPROC, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride))
+GLAD_FUNC_VOID(glSelectPerfMonitorCountersAMD, PFNGLSELECTPERFMONITORCOUNTERSAMDPROC, (GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList), (monitor, enable, group, numCounters, counterList))
+GLAD_FUNC_VOID(glSemaphoreParameterivNV, PFNGLSEMAPHOREPARAMETERIVNVPROC, (GLuint semaphore, GLenum pname, const GLint *params), (semaphore, pname, params))
+GLAD_FUNC_VOID(glSemaphoreParameterui64vEXT, PFNGLSEMAPHOREPARAMETERUI64VEXTPROC, (GLuint semaphore, GLenum pname, const GLuint64 *params), (semaphore, pname, params))
+GLAD_FUNC_VOID(glSeparableFilter2D, PFNGLSEPARABLEFILTER2DPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column), (target, internalformat, width, height, format, type, row, column))
+GLAD_FUNC_VOID(glSeparableFilter2DEXT, PFNGLSEPARABLEFILTER2DEXTPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column), (target, internalformat, width, height, format, type, row, column))
+GLAD_FUNC_VOID(glSetFenceAPPLE, PFNGLSETFENCEAPPLEPROC, (GLuint fence), (fence))
+GLAD_FUNC_VOID(glSetFenceNV, PFNGLSETFENCENVPROC, (GLuint fence, GLenum condition), (fence, condition))
+GLAD_FUNC_VOID(glSetFragmentShaderConstantATI, PFNGLSETFRAGMENTSHADERCONSTANTATIPROC, (GLuint dst, const GLfloat *value), (dst, value))
+GLAD_FUNC_VOID(glSetInvariantEXT, PFNGLSETINVARIANTEXTPROC, (GLuint id, GLenum type, const void *addr), (id, type, addr))
+GLAD_FUNC_VOID(glSetLocalConstantEXT, PFNGLSETLOCALCONSTANTEXTPROC, (GLuint id, GLenum type, const void *addr), (id, type, addr))
+GLAD_FUNC_VOID(glSetMultisamplefvAMD, PFNGLSETMULTISAMPLEFVAMDPROC, (GLenum pname, GLuint index, const GLfloat *val), (pname, index, val))
+GLAD_FUNC_VOID(glShaderBinary, PFNGLSHADERBINARYPROC, (GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length), (count, shaders, binaryFormat, binary, length))
+GLAD_FUNC_VOID(glShaderOp1EXT, PFNGLSHADEROP1EXTPROC, (GLenum op, GLuint res, GLuint arg1), (op, res, arg1))
+GLAD_FUNC_VOID(glShaderOp2EXT, PFNGLSHADEROP2EXTPROC, (GLenum op, GLuint res, GLuint arg1, GLuint arg2), (op, res, arg1, arg2))
+GLAD_FUNC_VOID(glShaderOp3EXT, PFNGLSHADEROP3EXTPROC, (GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3), (op, res, arg1, arg2, arg3))
+GLAD_FUNC_VOID(glShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GLAD_FUNC_VOID(glShaderSourceARB, PFNGLSHADERSOURCEARBPROC, (GLhandleARB shaderObj, GLsizei count, const GLcharARB **string, const GLint *length), (shaderObj, count, string, length))
+GLAD_FUNC_VOID(glShaderStorageBlockBinding, PFNGLSHADERSTORAGEBLOCKBINDINGPROC, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding))
+GLAD_FUNC_VOID(glShadingRateCombinerOpsEXT, PFNGLSHADINGRATECOMBINEROPSEXTPROC, (GLenum combinerOp0, GLenum combinerOp1), (combinerOp0, combinerOp1))
+GLAD_FUNC_VOID(glShadingRateEXT, PFNGLSHADINGRATEEXTPROC, (GLenum rate), (rate))
+GLAD_FUNC_VOID(glShadingRateImageBarrierNV, PFNGLSHADINGRATEIMAGEBARRIERNVPROC, (GLboolean synchronize), (synchronize))
+GLAD_FUNC_VOID(glShadingRateImagePaletteNV, PFNGLSHADINGRATEIMAGEPALETTENVPROC, (GLuint viewport, GLuint first, GLsizei count, const GLenum *rates), (viewport, first, count, rates))
+GLAD_FUNC_VOID(glShadingRateSampleOrderCustomNV, PFNGLSHADINGRATESAMPLEORDERCUSTOMNVPROC, (GLenum rate, GLuint samples, const GLint *locations), (rate, samples, locations))
+GLAD_FUNC_VOID(glShadingRateSampleOrderNV, PFNGLSHADINGRATESAMPLEORDERNVPROC, (GLenum order), (order))
+GLAD_FUNC_VOID(glSharpenTexFuncSGIS, PFNGLSHARPENTEXFUNCSGISPROC, (GLenum target, GLsizei n, const GLfloat *points), (target, n, points))
+GLAD_FUNC_VOID(glSignalSemaphoreEXT, PFNGLSIGNALSEMAPHOREEXTPROC, (GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts), (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts))
+GLAD_FUNC_VOID(glSignalSemaphoreui64NVX, PFNGLSIGNALSEMAPHOREUI64NVXPROC, (GLuint signalGpu, GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (signalGpu, fenceObjectCount, semaphoreArray, fenceValueArray))
+GLAD_FUNC_VOID(glSignalVkFenceNV, PFNGLSIGNALVKFENCENVPROC, (GLuint64 vkFence), (vkFence))
+GLAD_FUNC_VOID(glSignalVkSemaphoreNV, PFNGLSIGNALVKSEMAPHORENVPROC, (GLuint64 vkSemaphore), (vkSemaphore))
+GLAD_FUNC_VOID(glSpecializeShaderARB, PFNGLSPECIALIZESHADERARBPROC, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue))
+GLAD_FUNC_VOID(glSpriteParameterfSGIX, PFNGLSPRITEPARAMETERFSGIXPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glSpriteParameterfvSGIX, PFNGLSPRITEPARAMETERFVSGIXPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_FUNC_VOID(glSpriteParameteriSGIX, PFNGLSPRITEPARAMETERISGIXPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glSpriteParameterivSGIX, PFNGLSPRITEPARAMETERIVSGIXPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_FUNC_VOID(glStartInstrumentsSGIX, PFNGLSTARTINSTRUMENTSSGIXPROC, (void), ())
+GLAD_FUNC_VOID(glStateCaptureNV, PFNGLSTATECAPTURENVPROC, (GLuint state, GLenum mode), (state, mode))
+GLAD_FUNC_VOID(glStencilClearTagEXT, PFNGLSTENCILCLEARTAGEXTPROC, (GLsizei stencilTagBits, GLuint stencilClearTag), (stencilTagBits, stencilClearTag))
+GLAD_FUNC_VOID(glStencilFillPathInstancedNV, PFNGLSTENCILFILLPATHINSTANCEDNVPROC, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType, transformValues))
+GLAD_FUNC_VOID(glStencilFillPathNV, PFNGLSTENCILFILLPATHNVPROC, (GLuint path, GLenum fillMode, GLuint mask), (path, fillMode, mask))
+GLAD_FUNC_VOID(glStencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_FUNC_VOID(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GLAD_FUNC_VOID(glStencilFuncSeparateATI, PFNGLSTENCILFUNCSEPARATEATIPROC, (GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask), (frontfunc, backfunc, ref, mask))
+GLAD_FUNC_VOID(glStencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask))
+GLAD_FUNC_VOID(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask))
+GLAD_FUNC_VOID(glStencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GLAD_FUNC_VOID(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_FUNC_VOID(glStencilOpSeparateATI, PFNGLSTENCILOPSEPARATEATIPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_FUNC_VOID(glStencilOpValueAMD, PFNGLSTENCILOPVALUEAMDPROC, (GLenum face, GLuint value), (face, value))
+GLAD_FUNC_VOID(glStencilStrokePathInstancedNV, PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, reference, mask, transformType, transformValues))
+GLAD_FUNC_VOID(glStencilStrokePathNV, PFNGLSTENCILSTROKEPATHNVPROC, (GLuint path, GLint reference, GLuint mask), (path, reference, mask))
+GLAD_FUNC_VOID(glStencilThenCoverFillPathInstancedNV, PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode, transformType, transformValues))
+GLAD_FUNC_VOID(glStencilThenCoverFillPathNV, PFNGLSTENCILTHENCOVERFILLPATHNVPROC, (GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode), (path, fillMode, mask, coverMode))
+GLAD_FUNC_VOID(glStencilThenCoverStrokePathInstancedNV, PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, reference, mask, coverMode, transformType, transformValues))
+GLAD_FUNC_VOID(glStencilThenCoverStrokePathNV, PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC, (GLuint path, GLint reference, GLuint mask, GLenum coverMode), (path, reference, mask, coverMode))
+GLAD_FUNC_VOID(glStopInstrumentsSGIX, PFNGLSTOPINSTRUMENTSSGIXPROC, (GLint marker), (marker))
+GLAD_FUNC_VOID(glStringMarkerGREMEDY, PFNGLSTRINGMARKERGREMEDYPROC, (GLsizei len, const void *string), (len, string))
+GLAD_FUNC_VOID(glSubpixelPrecisionBiasNV, PFNGLSUBPIXELPRECISIONBIASNVPROC, (GLuint xbits, GLuint ybits), (xbits, ybits))
+GLAD_FUNC_VOID(glSwizzleEXT, PFNGLSWIZZLEEXTPROC, (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW), (res, in, outX, outY, outZ, outW))
+GLAD_FUNC_VOID(glSyncTextureINTEL, PFNGLSYNCTEXTUREINTELPROC, (GLuint texture), (texture))
+GLAD_FUNC_VOID(glTagSampleBufferSGIX, PFNGLTAGSAMPLEBUFFERSGIXPROC, (void), ())
+GLAD_FUNC_VOID(glTangent3bEXT, PFNGLTANGENT3BEXTPROC, (GLbyte tx, GLbyte ty, GLbyte tz), (tx, ty, tz))
+GLAD_FUNC_VOID(glTangent3bvEXT, PFNGLTANGENT3BVEXTPROC, (const GLbyte *v), (v))
+GLAD_FUNC_VOID(glTangent3dEXT, PFNGLTANGENT3DEXTPROC, (GLdouble tx, GLdouble ty, GLdouble tz), (tx, ty, tz))
+GLAD_FUNC_VOID(glTangent3dvEXT, PFNGLTANGENT3DVEXTPROC, (const GLdouble *v), (v))
+GLAD_FUNC_VOID(glTangent3fEXT, PFNGLTANGENT3FEXTPROC, (GLfloat tx, GLfloat ty, GLfloat tz), (tx, ty, tz))
+GLAD_FUNC_VOID(glTangent3fvEXT, PFNGLTANGENT3FVEXTPROC, (const GLfloat *v), (v))
+GLAD_FUNC_VOID(glTangent3iEXT, PFNGLTANGENT3IEXTPROC, (GLint tx, GLint ty, GLint tz), (tx, ty, tz))
+GLAD_FUNC_VOID(glTangent3ivEXT, PFNGLTANGENT3IVEXTPROC, (const GLint *v), (v))
+GLAD_FUNC_VOID(glTangent3sEXT, PFNGLTANGENT3SEXTPROC, (GLshort tx, GLshort ty, GLshort tz), (tx, ty, tz))
+GLAD_FUNC_VOID(glTangent3svEXT, PFNGLTANGENT3SVEXTPROC, (const GLshort *v), (v))
+GLAD_FUNC_VOID(glTangentPointerEXT, PFNGLTANGENTPOINTEREXTPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GLAD_FUNC_VOID(glTbufferMask3DFX, PFNGLTBUFFERMASK3DFXPROC, (GLuint mask), (mask))
+GLAD_FUNC_VOID(glTessellationFactorAMD, PFNGLTESSELLATIONFACTORAMDPROC, (GLfloat factor), (factor))
+GLAD_FUNC_VOID(glTessellationModeAMD, PFNGLTESSELLATIONMODEAMDPROC, (GLenum mode), (mode))
+GLAD_FUNC(GLboolean, glTestFenceAPPLE, PFNGLTESTFENCEAPPLEPROC, (GLuint fence), (fence))
+GLAD_FUNC(GLboolean, glTestFenceNV, PFNGLTESTFENCENVPROC, (GLuint fence), (fence))
+GLAD_FUNC(GLboolean, glTestObjectAPPLE, PFNGLTESTOBJECTAPPLEPROC, (GLenum object, GLuint name), (object, name))
+GLAD_FUNC_VOID(glTexAttachMemoryNV, PFNGLTEXATTACHMEMORYNVPROC, (GLenum target, GLuint memory, GLuint64 offset), (target, memory, offset))
+GLAD_FUNC_VOID(glTexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_FUNC_VOID(glTexBufferARB, PFNGLTEXBUFFERARBPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_FUNC_VOID(glTexBufferEXT, PFNGLTEXBUFFEREXTPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_FUNC_VOID(glTexBufferRange, PFNGLTEXBUFFERRANGEPROC, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size))
+GLAD_FUNC_VOID(glTexBumpParameterfvATI, PFNGLTEXBUMPPARAMETERFVATIPROC, (GLenum pname, const GLfloat *param), (pname, param))
+GLAD_FUNC_VOID(glTexBumpParameterivATI, PFNGLTEXBUMPPARAMETERIVATIPROC, (GLenum pname, const GLint *param), (pname, param))
+GLAD_FUNC_VOID(glTexCoord1bOES, PFNGLTEXCOORD1BOESPROC, (GLbyte s), (s))
+GLAD_FUNC_VOID(glTexCoord1bvOES, PFNGLTEXCOORD1BVOESPROC, (const GLbyte *coords), (coords))
+GLAD_FUNC_VOID(glTexCoord1hNV, PFNGLTEXCOORD1HNVPROC, (GLhalfNV s), (s))
+GLAD_FUNC_VOID(glTexCoord1hvNV, PFNGLTEXCOORD1HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glTexCoord1xOES, PFNGLTEXCOORD1XOESPROC, (GLfixed s), (s))
+GLAD_FUNC_VOID(glTexCoord1xvOES, PFNGLTEXCOORD1XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glTexCoord2bOES, PFNGLTEXCOORD2BOESPROC, (GLbyte s, GLbyte t), (s, t))
+GLAD_FUNC_VOID(glTexCoord2bvOES, PFNGLTEXCOORD2BVOESPROC, (const GLbyte *coords), (coords))
+GLAD_FUNC_VOID(glTexCoord2fColor3fVertex3fSUN, PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC, (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, x, y, z))
+GLAD_FUNC_VOID(glTexCoord2fColor3fVertex3fvSUN, PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC, (const GLfloat *tc, const GLfloat *c, const GLfloat *v), (tc, c, v))
+GLAD_FUNC_VOID(glTexCoord2fColor4fNormal3fVertex3fSUN, PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC, (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, a, nx, ny, nz, x, y, z))
+GLAD_FUNC_VOID(glTexCoord2fColor4fNormal3fVertex3fvSUN, PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC, (const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (tc, c, n, v))
+GLAD_FUNC_VOID(glTexCoord2fColor4ubVertex3fSUN, PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC, (GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, a, x, y, z))
+GLAD_FUNC_VOID(glTexCoord2fColor4ubVertex3fvSUN, PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC, (const GLfloat *tc, const GLubyte *c, const GLfloat *v), (tc, c, v))
+GLAD_FUNC_VOID(glTexCoord2fNormal3fVertex3fSUN, PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC, (GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (s, t, nx, ny, nz, x, y, z))
+GLAD_FUNC_VOID(glTexCoord2fNormal3fVertex3fvSUN, PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC, (const GLfloat *tc, const GLfloat *n, const GLfloat *v), (tc, n, v))
+GLAD_FUNC_VOID(glTexCoord2fVertex3fSUN, PFNGLTEXCOORD2FVERTEX3FSUNPROC, (GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z), (s, t, x, y, z))
+GLAD_FUNC_VOID(glTexCoord2fVertex3fvSUN, PFNGLTEXCOORD2FVERTEX3FVSUNPROC, (const GLfloat *tc, const GLfloat *v), (tc, v))
+GLAD_FUNC_VOID(glTexCoord2hNV, PFNGLTEXCOORD2HNVPROC, (GLhalfNV s, GLhalfNV t), (s, t))
+GLAD_FUNC_VOID(glTexCoord2hvNV, PFNGLTEXCOORD2HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glTexCoord2xOES, PFNGLTEXCOORD2XOESPROC, (GLfixed s, GLfixed t), (s, t))
+GLAD_FUNC_VOID(glTexCoord2xvOES, PFNGLTEXCOORD2XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glTexCoord3bOES, PFNGLTEXCOORD3BOESPROC, (GLbyte s, GLbyte t, GLbyte r), (s, t, r))
+GLAD_FUNC_VOID(glTexCoord3bvOES, PFNGLTEXCOORD3BVOESPROC, (const GLbyte *coords), (coords))
+GLAD_FUNC_VOID(glTexCoord3hNV, PFNGLTEXCOORD3HNVPROC, (GLhalfNV s, GLhalfNV t, GLhalfNV r), (s, t, r))
+GLAD_FUNC_VOID(glTexCoord3hvNV, PFNGLTEXCOORD3HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glTexCoord3xOES, PFNGLTEXCOORD3XOESPROC, (GLfixed s, GLfixed t, GLfixed r), (s, t, r))
+GLAD_FUNC_VOID(glTexCoord3xvOES, PFNGLTEXCOORD3XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glTexCoord4bOES, PFNGLTEXCOORD4BOESPROC, (GLbyte s, GLbyte t, GLbyte r, GLbyte q), (s, t, r, q))
+GLAD_FUNC_VOID(glTexCoord4bvOES, PFNGLTEXCOORD4BVOESPROC, (const GLbyte *coords), (coords))
+GLAD_FUNC_VOID(glTexCoord4fColor4fNormal3fVertex4fSUN, PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC, (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w))
+GLAD_FUNC_VOID(glTexCoord4fColor4fNormal3fVertex4fvSUN, PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC, (const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (tc, c, n, v))
+GLAD_FUNC_VOID(glTexCoord4fVertex4fSUN, PFNGLTEXCOORD4FVERTEX4FSUNPROC, (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (s, t, p, q, x, y, z, w))
+GLAD_FUNC_VOID(glTexCoord4fVertex4fvSUN, PFNGLTEXCOORD4FVERTEX4FVSUNPROC, (const GLfloat *tc, const GLfloat *v), (tc, v))
+GLAD_FUNC_VOID(glTexCoord4hNV, PFNGLTEXCOORD4HNVPROC, (GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q), (s, t, r, q))
+GLAD_FUNC_VOID(glTexCoord4hvNV, PFNGLTEXCOORD4HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glTexCoord4xOES, PFNGLTEXCOORD4XOESPROC, (GLfixed s, GLfixed t, GLfixed r, GLfixed q), (s, t, r, q))
+GLAD_FUNC_VOID(glTexCoord4xvOES, PFNGLTEXCOORD4XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glTexCoordFormatNV, PFNGLTEXCOORDFORMATNVPROC, (GLint size, GLenum type, GLsizei stride), (size, type, stride))
+GLAD_FUNC_VOID(glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_FUNC_VOID(glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_FUNC_VOID(glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_FUNC_VOID(glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_FUNC_VOID(glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_FUNC_VOID(glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_FUNC_VOID(glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_FUNC_VOID(glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_FUNC_VOID(glTexCoordPointerEXT, PFNGLTEXCOORDPOINTEREXTPROC, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer))
+GLAD_FUNC_VOID(glTexCoordPointerListIBM, PFNGLTEXCOORDPOINTERLISTIBMPROC, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride))
+GLAD_FUNC_VOID(glTexCoordPointervINTEL, PFNGLTEXCOORDPOINTERVINTELPROC, (GLint size, GLenum type, const void **pointer), (size, type, pointer))
+GLAD_FUNC_VOID(glTexEnvxOES, PFNGLTEXENVXOESPROC, (GLenum target, GLenum pname, GLfixed param), (target, pname, param))
+GLAD_FUNC_VOID(glTexEnvxvOES, PFNGLTEXENVXVOESPROC, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params))
+GLAD_FUNC_VOID(glTexFilterFuncSGIS, PFNGLTEXFILTERFUNCSGISPROC, (GLenum target, GLenum filter, GLsizei n, const GLfloat *weights), (target, filter, n, weights))
+GLAD_FUNC_VOID(glTexGenxOES, PFNGLTEXGENXOESPROC, (GLenum coord, GLenum pname, GLfixed param), (coord, pname, param))
+GLAD_FUNC_VOID(glTexGenxvOES, PFNGLTEXGENXVOESPROC, (GLenum coord, GLenum pname, const GLfixed *params), (coord, pname, params))
+GLAD_FUNC_VOID(glTexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GLAD_FUNC_VOID(glTexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_FUNC_VOID(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_FUNC_VOID(glTexImage2DMultisampleCoverageNV, PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations))
+GLAD_FUNC_VOID(glTexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_FUNC_VOID(glTexImage3DEXT, PFNGLTEXIMAGE3DEXTPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_FUNC_VOID(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_FUNC_VOID(glTexImage3DMultisampleCoverageNV, PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations))
+GLAD_FUNC_VOID(glTexImage4DSGIS, PFNGLTEXIMAGE4DSGISPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, size4d, border, format, type, pixels))
+GLAD_FUNC_VOID(glTexPageCommitmentARB, PFNGLTEXPAGECOMMITMENTARBPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit), (target, level, xoffset, yoffset, zoffset, width, height, depth, commit))
+GLAD_FUNC_VOID(glTexPageCommitmentMemNV, PFNGLTEXPAGECOMMITMENTMEMNVPROC, (GLenum target, GLint layer, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset, GLboolean commit), (target, layer, level, xoffset, yoffset, zoffset, width, height, depth, memory, offset, commit))
+GLAD_FUNC_VOID(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glTexParameterIivEXT, PFNGLTEXPARAMETERIIVEXTPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_FUNC_VOID(glTexParameterIuivEXT, PFNGLTEXPARAMETERIUIVEXTPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_FUNC_VOID(glTexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_FUNC_VOID(glTexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_FUNC_VOID(glTexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_FUNC_VOID(glTexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_FUNC_VOID(glTexParameterxOES, PFNGLTEXPARAMETERXOESPROC, (GLenum target, GLenum pname, GLfixed param), (target, pname, param))
+GLAD_FUNC_VOID(glTexParameterxvOES, PFNGLTEXPARAMETERXVOESPROC, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params))
+GLAD_FUNC_VOID(glTexRenderbufferNV, PFNGLTEXRENDERBUFFERNVPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_FUNC_VOID(glTexStorage1D, PFNGLTEXSTORAGE1DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width))
+GLAD_FUNC_VOID(glTexStorage1DEXT, PFNGLTEXSTORAGE1DEXTPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width))
+GLAD_FUNC_VOID(glTexStorage2D, PFNGLTEXSTORAGE2DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+GLAD_FUNC_VOID(glTexStorage2DEXT, PFNGLTEXSTORAGE2DEXTPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+GLAD_FUNC_VOID(glTexStorage2DMultisample, PFNGLTEXSTORAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_FUNC_VOID(glTexStorage3D, PFNGLTEXSTORAGE3DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+GLAD_FUNC_VOID(glTexStorage3DEXT, PFNGLTEXSTORAGE3DEXTPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+GLAD_FUNC_VOID(glTexStorage3DMultisample, PFNGLTEXSTORAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_FUNC_VOID(glTexStorageMem1DEXT, PFNGLTEXSTORAGEMEM1DEXTPROC, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, memory, offset))
+GLAD_FUNC_VOID(glTexStorageMem2DEXT, PFNGLTEXSTORAGEMEM2DEXTPROC, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, height, memory, offset))
+GLAD_FUNC_VOID(glTexStorageMem2DMultisampleEXT, PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC, (GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset))
+GLAD_FUNC_VOID(glTexStorageMem3DEXT, PFNGLTEXSTORAGEMEM3DEXTPROC, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, height, depth, memory, offset))
+GLAD_FUNC_VOID(glTexStorageMem3DMultisampleEXT, PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC, (GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset))
+GLAD_FUNC_VOID(glTexStorageSparseAMD, PFNGLTEXSTORAGESPARSEAMDPROC, (GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags), (target, internalFormat, width, height, depth, layers, flags))
+GLAD_FUNC_VOID(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_FUNC_VOID(glTexSubImage1DEXT, PFNGLTEXSUBIMAGE1DEXTPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_FUNC_VOID(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_FUNC_VOID(glTexSubImage2DEXT, PFNGLTEXSUBIMAGE2DEXTPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_FUNC_VOID(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_FUNC_VOID(glTexSubImage3DEXT, PFNGLTEXSUBIMAGE3DEXTPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_FUNC_VOID(glTexSubImage4DSGIS, PFNGLTEXSUBIMAGE4DSGISPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels))
+GLAD_FUNC_VOID(glTextureAttachMemoryNV, PFNGLTEXTUREATTACHMEMORYNVPROC, (GLuint texture, GLuint memory, GLuint64 offset), (texture, memory, offset))
+GLAD_FUNC_VOID(glTextureBarrier, PFNGLTEXTUREBARRIERPROC, (void), ())
+GLAD_FUNC_VOID(glTextureBarrierNV, PFNGLTEXTUREBARRIERNVPROC, (void), ())
+GLAD_FUNC_VOID(glTextureBuffer, PFNGLTEXTUREBUFFERPROC, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer))
+GLAD_FUNC_VOID(glTextureBufferEXT, PFNGLTEXTUREBUFFEREXTPROC, (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer), (texture, target, internalformat, buffer))
+GLAD_FUNC_VOID(glTextureBufferRange, PFNGLTEXTUREBUFFERRANGEPROC, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size))
+GLAD_FUNC_VOID(glTextureBufferRangeEXT, PFNGLTEXTUREBUFFERRANGEEXTPROC, (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, target, internalformat, buffer, offset, size))
+GLAD_FUNC_VOID(glTextureColorMaskSGIS, PFNGLTEXTURECOLORMASKSGISPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_FUNC_VOID(glTextureImage1DEXT, PFNGLTEXTUREIMAGE1DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, border, format, type, pixels))
+GLAD_FUNC_VOID(glTextureImage2DEXT, PFNGLTEXTUREIMAGE2DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_FUNC_VOID(glTextureImage2DMultisampleCoverageNV, PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC, (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (texture, target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations))
+GLAD_FUNC_VOID(glTextureImage2DMultisampleNV, PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC, (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (texture, target, samples, internalFormat, width, height, fixedSampleLocations))
+GLAD_FUNC_VOID(glTextureImage3DEXT, PFNGLTEXTUREIMAGE3DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_FUNC_VOID(glTextureImage3DMultisampleCoverageNV, PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC, (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (texture, target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations))
+GLAD_FUNC_VOID(glTextureImage3DMultisampleNV, PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC, (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (texture, target, samples, internalFormat, width, height, depth, fixedSampleLocations))
+GLAD_FUNC_VOID(glTextureLightEXT, PFNGLTEXTURELIGHTEXTPROC, (GLenum pname), (pname))
+GLAD_FUNC_VOID(glTextureMaterialEXT, PFNGLTEXTUREMATERIALEXTPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_FUNC_VOID(glTextureNormalEXT, PFNGLTEXTURENORMALEXTPROC, (GLenum mode), (mode))
+GLAD_FUNC_VOID(glTexturePageCommitmentEXT, PFNGLTEXTUREPAGECOMMITMENTEXTPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit), (texture, level, xoffset, yoffset, zoffset, width, height, depth, commit))
+GLAD_FUNC_VOID(glTexturePageCommitmentMemNV, PFNGLTEXTUREPAGECOMMITMENTMEMNVPROC, (GLuint texture, GLint layer, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset, GLboolean commit), (texture, layer, level, xoffset, yoffset, zoffset, width, height, depth, memory, offset, commit))
+GLAD_FUNC_VOID(glTextureParameterIiv, PFNGLTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, const GLint *params), (texture, pname, params))
+GLAD_FUNC_VOID(glTextureParameterIivEXT, PFNGLTEXTUREPARAMETERIIVEXTPROC, (GLuint texture, GLenum target, GLenum pname, const GLint *params), (texture, target, pname, params))
+GLAD_FUNC_VOID(glTextureParameterIuiv, PFNGLTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, const GLuint *params), (texture, pname, params))
+GLAD_FUNC_VOID(glTextureParameterIuivEXT, PFNGLTEXTUREPARAMETERIUIVEXTPROC, (GLuint texture, GLenum target, GLenum pname, const GLuint *params), (texture, target, pname, params))
+GLAD_FUNC_VOID(glTextureParameterf, PFNGLTEXTUREPARAMETERFPROC, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param))
+GLAD_FUNC_VOID(glTextureParameterfEXT, PFNGLTEXTUREPARAMETERFEXTPROC, (GLuint texture, GLenum target, GLenum pname, GLfloat param), (texture, target, pname, param))
+GLAD_FUNC_VOID(glTextureParameterfv, PFNGLTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, const GLfloat *param), (texture, pname, param))
+GLAD_FUNC_VOID(glTextureParameterfvEXT, PFNGLTEXTUREPARAMETERFVEXTPROC, (GLuint texture, GLenum target, GLenum pname, const GLfloat *params), (texture, target, pname, params))
+GLAD_FUNC_VOID(glTextureParameteri, PFNGLTEXTUREPARAMETERIPROC, (GLuint texture, GLenum pname, GLint param), (texture, pname, param))
+GLAD_FUNC_VOID(glTextureParameteriEXT, PFNGLTEXTUREPARAMETERIEXTPROC, (GLuint texture, GLenum target, GLenum pname, GLint param), (texture, target, pname, param))
+GLAD_FUNC_VOID(glTextureParameteriv, PFNGLTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, const GLint *param), (texture, pname, param))
+GLAD_FUNC_VOID(glTextureParameterivEXT, PFNGLTEXTUREPARAMETERIVEXTPROC, (GLuint texture, GLenum target, GLenum pname, const GLint *params), (texture, target, pname, params))
+GLAD_FUNC_VOID(glTextureRangeAPPLE, PFNGLTEXTURERANGEAPPLEPROC, (GLenum target, GLsizei length, const void *pointer), (target, length, pointer))
+GLAD_FUNC_VOID(glTextureRenderbufferEXT, PFNGLTEXTURERENDERBUFFEREXTPROC, (GLuint texture, GLenum target, GLuint renderbuffer), (texture, target, renderbuffer))
+GLAD_FUNC_VOID(glTextureStorage1D, PFNGLTEXTURESTORAGE1DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width))
+GLAD_FUNC_VOID(glTextureStorage1DEXT, PFNGLTEXTURESTORAGE1DEXTPROC, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (texture, target, levels, internalformat, width))
+GLAD_FUNC_VOID(glTextureStorage2D, PFNGLTEXTURESTORAGE2DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height))
+GLAD_FUNC_VOID(glTextureStorage2DEXT, PFNGLTEXTURESTORAGE2DEXTPROC, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, target, levels, internalformat, width, height))
+GLAD_FUNC_VOID(glTextureStorage2DMultisample, PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_FUNC_VOID(glTextureStorage2DMultisampleEXT, PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC, (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_FUNC_VOID(glTextureStorage3D, PFNGLTEXTURESTORAGE3DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth))
+GLAD_FUNC_VOID(glTextureStorage3DEXT, PFNGLTEXTURESTORAGE3DEXTPROC, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, target, levels, internalformat, width, height, depth))
+GLAD_FUNC_VOID(glTextureStorage3DMultisample, PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_FUNC_VOID(glTextureStorage3DMultisampleEXT, PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC, (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_FUNC_VOID(glTextureStorageMem1DEXT, PFNGLTEXTURESTORAGEMEM1DEXTPROC, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, memory, offset))
+GLAD_FUNC_VOID(glTextureStorageMem2DEXT, PFNGLTEXTURESTORAGEMEM2DEXTPROC, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, height, memory, offset))
+GLAD_FUNC_VOID(glTextureStorageMem2DMultisampleEXT, PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC, (GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset))
+GLAD_FUNC_VOID(glTextureStorageMem3DEXT, PFNGLTEXTURESTORAGEMEM3DEXTPROC, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, height, depth, memory, offset))
+GLAD_FUNC_VOID(glTextureStorageMem3DMultisampleEXT, PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC, (GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset))
+GLAD_FUNC_VOID(glTextureStorageSparseAMD, PFNGLTEXTURESTORAGESPARSEAMDPROC, (GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags), (texture, target, internalFormat, width, height, depth, layers, flags))
+GLAD_FUNC_VOID(glTextureSubImage1D, PFNGLTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, width, format, type, pixels))
+GLAD_FUNC_VOID(glTextureSubImage1DEXT, PFNGLTEXTURESUBIMAGE1DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, width, format, type, pixels))
+GLAD_FUNC_VOID(glTextureSubImage2D, PFNGLTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_FUNC_VOID(glTextureSubImage2DEXT, PFNGLTEXTURESUBIMAGE2DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_FUNC_VOID(glTextureSubImage3D, PFNGLTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_FUNC_VOID(glTextureSubImage3DEXT, PFNGLTEXTURESUBIMAGE3DEXTPROC, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_FUNC_VOID(glTextureView, PFNGLTEXTUREVIEWPROC, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers))
+GLAD_FUNC_VOID(glTrackMatrixNV, PFNGLTRACKMATRIXNVPROC, (GLenum target, GLuint address, GLenum matrix, GLenum transform), (target, address, matrix, transform))
+GLAD_FUNC_VOID(glTransformFeedbackAttribsNV, PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC, (GLsizei count, const GLint *attribs, GLenum bufferMode), (count, attribs, bufferMode))
+GLAD_FUNC_VOID(glTransformFeedbackBufferBase, PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer))
+GLAD_FUNC_VOID(glTransformFeedbackBufferRange, PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size))
+GLAD_FUNC_VOID(glTransformFeedbackStreamAttribsNV, PFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC, (GLsizei count, const GLint *attribs, GLsizei nbuffers, const GLint *bufstreams, GLenum bufferMode), (count, attribs, nbuffers, bufstreams, bufferMode))
+GLAD_FUNC_VOID(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_FUNC_VOID(glTransformFeedbackVaryingsEXT, PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_FUNC_VOID(glTransformFeedbackVaryingsNV, PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC, (GLuint program, GLsizei count, const GLint *locations, GLenum bufferMode), (program, count, locations, bufferMode))
+GLAD_FUNC_VOID(glTransformPathNV, PFNGLTRANSFORMPATHNVPROC, (GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat *transformValues), (resultPath, srcPath, transformType, transformValues))
+GLAD_FUNC_VOID(glTranslatexOES, PFNGLTRANSLATEXOESPROC, (GLfixed x, GLfixed y, GLfixed z), (x, y, z))
+GLAD_FUNC_VOID(glUniform1d, PFNGLUNIFORM1DPROC, (GLint location, GLdouble x), (location, x))
+GLAD_FUNC_VOID(glUniform1dv, PFNGLUNIFORM1DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0))
+GLAD_FUNC_VOID(glUniform1fARB, PFNGLUNIFORM1FARBPROC, (GLint location, GLfloat v0), (location, v0))
+GLAD_FUNC_VOID(glUniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1fvARB, PFNGLUNIFORM1FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0))
+GLAD_FUNC_VOID(glUniform1i64ARB, PFNGLUNIFORM1I64ARBPROC, (GLint location, GLint64 x), (location, x))
+GLAD_FUNC_VOID(glUniform1i64NV, PFNGLUNIFORM1I64NVPROC, (GLint location, GLint64EXT x), (location, x))
+GLAD_FUNC_VOID(glUniform1i64vARB, PFNGLUNIFORM1I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1i64vNV, PFNGLUNIFORM1I64VNVPROC, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1iARB, PFNGLUNIFORM1IARBPROC, (GLint location, GLint v0), (location, v0))
+GLAD_FUNC_VOID(glUniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1ivARB, PFNGLUNIFORM1IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0))
+GLAD_FUNC_VOID(glUniform1ui64ARB, PFNGLUNIFORM1UI64ARBPROC, (GLint location, GLuint64 x), (location, x))
+GLAD_FUNC_VOID(glUniform1ui64NV, PFNGLUNIFORM1UI64NVPROC, (GLint location, GLuint64EXT x), (location, x))
+GLAD_FUNC_VOID(glUniform1ui64vARB, PFNGLUNIFORM1UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1ui64vNV, PFNGLUNIFORM1UI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1uiEXT, PFNGLUNIFORM1UIEXTPROC, (GLint location, GLuint v0), (location, v0))
+GLAD_FUNC_VOID(glUniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform1uivEXT, PFNGLUNIFORM1UIVEXTPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2d, PFNGLUNIFORM2DPROC, (GLint location, GLdouble x, GLdouble y), (location, x, y))
+GLAD_FUNC_VOID(glUniform2dv, PFNGLUNIFORM2DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_FUNC_VOID(glUniform2fARB, PFNGLUNIFORM2FARBPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_FUNC_VOID(glUniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2fvARB, PFNGLUNIFORM2FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_FUNC_VOID(glUniform2i64ARB, PFNGLUNIFORM2I64ARBPROC, (GLint location, GLint64 x, GLint64 y), (location, x, y))
+GLAD_FUNC_VOID(glUniform2i64NV, PFNGLUNIFORM2I64NVPROC, (GLint location, GLint64EXT x, GLint64EXT y), (location, x, y))
+GLAD_FUNC_VOID(glUniform2i64vARB, PFNGLUNIFORM2I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2i64vNV, PFNGLUNIFORM2I64VNVPROC, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2iARB, PFNGLUNIFORM2IARBPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_FUNC_VOID(glUniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2ivARB, PFNGLUNIFORM2IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_FUNC_VOID(glUniform2ui64ARB, PFNGLUNIFORM2UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y), (location, x, y))
+GLAD_FUNC_VOID(glUniform2ui64NV, PFNGLUNIFORM2UI64NVPROC, (GLint location, GLuint64EXT x, GLuint64EXT y), (location, x, y))
+GLAD_FUNC_VOID(glUniform2ui64vARB, PFNGLUNIFORM2UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2ui64vNV, PFNGLUNIFORM2UI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2uiEXT, PFNGLUNIFORM2UIEXTPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_FUNC_VOID(glUniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform2uivEXT, PFNGLUNIFORM2UIVEXTPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3d, PFNGLUNIFORM3DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z))
+GLAD_FUNC_VOID(glUniform3dv, PFNGLUNIFORM3DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_FUNC_VOID(glUniform3fARB, PFNGLUNIFORM3FARBPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_FUNC_VOID(glUniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3fvARB, PFNGLUNIFORM3FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_FUNC_VOID(glUniform3i64ARB, PFNGLUNIFORM3I64ARBPROC, (GLint location, GLint64 x, GLint64 y, GLint64 z), (location, x, y, z))
+GLAD_FUNC_VOID(glUniform3i64NV, PFNGLUNIFORM3I64NVPROC, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z), (location, x, y, z))
+GLAD_FUNC_VOID(glUniform3i64vARB, PFNGLUNIFORM3I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3i64vNV, PFNGLUNIFORM3I64VNVPROC, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3iARB, PFNGLUNIFORM3IARBPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_FUNC_VOID(glUniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3ivARB, PFNGLUNIFORM3IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_FUNC_VOID(glUniform3ui64ARB, PFNGLUNIFORM3UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (location, x, y, z))
+GLAD_FUNC_VOID(glUniform3ui64NV, PFNGLUNIFORM3UI64NVPROC, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (location, x, y, z))
+GLAD_FUNC_VOID(glUniform3ui64vARB, PFNGLUNIFORM3UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3ui64vNV, PFNGLUNIFORM3UI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3uiEXT, PFNGLUNIFORM3UIEXTPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_FUNC_VOID(glUniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform3uivEXT, PFNGLUNIFORM3UIVEXTPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4d, PFNGLUNIFORM4DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w))
+GLAD_FUNC_VOID(glUniform4dv, PFNGLUNIFORM4DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glUniform4fARB, PFNGLUNIFORM4FARBPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glUniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4fvARB, PFNGLUNIFORM4FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glUniform4i64ARB, PFNGLUNIFORM4I64ARBPROC, (GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (location, x, y, z, w))
+GLAD_FUNC_VOID(glUniform4i64NV, PFNGLUNIFORM4I64NVPROC, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (location, x, y, z, w))
+GLAD_FUNC_VOID(glUniform4i64vARB, PFNGLUNIFORM4I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4i64vNV, PFNGLUNIFORM4I64VNVPROC, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4iARB, PFNGLUNIFORM4IARBPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glUniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4ivARB, PFNGLUNIFORM4IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glUniform4ui64ARB, PFNGLUNIFORM4UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (location, x, y, z, w))
+GLAD_FUNC_VOID(glUniform4ui64NV, PFNGLUNIFORM4UI64NVPROC, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (location, x, y, z, w))
+GLAD_FUNC_VOID(glUniform4ui64vARB, PFNGLUNIFORM4UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4ui64vNV, PFNGLUNIFORM4UI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4uiEXT, PFNGLUNIFORM4UIEXTPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_FUNC_VOID(glUniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniform4uivEXT, PFNGLUNIFORM4UIVEXTPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_FUNC_VOID(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_FUNC_VOID(glUniformBufferEXT, PFNGLUNIFORMBUFFEREXTPROC, (GLuint program, GLint location, GLuint buffer), (program, location, buffer))
+GLAD_FUNC_VOID(glUniformHandleui64ARB, PFNGLUNIFORMHANDLEUI64ARBPROC, (GLint location, GLuint64 value), (location, value))
+GLAD_FUNC_VOID(glUniformHandleui64NV, PFNGLUNIFORMHANDLEUI64NVPROC, (GLint location, GLuint64 value), (location, value))
+GLAD_FUNC_VOID(glUniformHandleui64vARB, PFNGLUNIFORMHANDLEUI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniformHandleui64vNV, PFNGLUNIFORMHANDLEUI64VNVPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GLAD_FUNC_VOID(glUniformMatrix2dv, PFNGLUNIFORMMATRIX2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix2fvARB, PFNGLUNIFORMMATRIX2FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix2x3dv, PFNGLUNIFORMMATRIX2X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix2x4dv, PFNGLUNIFORMMATRIX2X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix3dv, PFNGLUNIFORMMATRIX3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix3fvARB, PFNGLUNIFORMMATRIX3FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix3x2dv, PFNGLUNIFORMMATRIX3X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix3x4dv, PFNGLUNIFORMMATRIX3X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix4dv, PFNGLUNIFORMMATRIX4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix4fvARB, PFNGLUNIFORMMATRIX4FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix4x2dv, PFNGLUNIFORMMATRIX4X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix4x3dv, PFNGLUNIFORMMATRIX4X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_FUNC_VOID(glUniformSubroutinesuiv, PFNGLUNIFORMSUBROUTINESUIVPROC, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices))
+GLAD_FUNC_VOID(glUniformui64NV, PFNGLUNIFORMUI64NVPROC, (GLint location, GLuint64EXT value), (location, value))
+GLAD_FUNC_VOID(glUniformui64vNV, PFNGLUNIFORMUI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GLAD_FUNC_VOID(glUnlockArraysEXT, PFNGLUNLOCKARRAYSEXTPROC, (void), ())
+GLAD_FUNC(GLboolean, glUnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target))
+GLAD_FUNC(GLboolean, glUnmapBufferARB, PFNGLUNMAPBUFFERARBPROC, (GLenum target), (target))
+GLAD_FUNC(GLboolean, glUnmapNamedBuffer, PFNGLUNMAPNAMEDBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_FUNC(GLboolean, glUnmapNamedBufferEXT, PFNGLUNMAPNAMEDBUFFEREXTPROC, (GLuint buffer), (buffer))
+GLAD_FUNC_VOID(glUnmapObjectBufferATI, PFNGLUNMAPOBJECTBUFFERATIPROC, (GLuint buffer), (buffer))
+GLAD_FUNC_VOID(glUnmapTexture2DINTEL, PFNGLUNMAPTEXTURE2DINTELPROC, (GLuint texture, GLint level), (texture, level))
+GLAD_FUNC_VOID(glUpdateObjectBufferATI, PFNGLUPDATEOBJECTBUFFERATIPROC, (GLuint buffer, GLuint offset, GLsizei size, const void *pointer, GLenum preserve), (buffer, offset, size, pointer, preserve))
+GLAD_FUNC_VOID(glUploadGpuMaskNVX, PFNGLUPLOADGPUMASKNVXPROC, (GLbitfield mask), (mask))
+GLAD_FUNC_VOID(glUseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program))
+GLAD_FUNC_VOID(glUseProgramObjectARB, PFNGLUSEPROGRAMOBJECTARBPROC, (GLhandleARB programObj), (programObj))
+GLAD_FUNC_VOID(glUseProgramStages, PFNGLUSEPROGRAMSTAGESPROC, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program))
+GLAD_FUNC_VOID(glUseProgramStagesEXT, PFNGLUSEPROGRAMSTAGESEXTPROC, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program))
+GLAD_FUNC_VOID(glUseShaderProgramEXT, PFNGLUSESHADERPROGRAMEXTPROC, (GLenum type, GLuint program), (type, program))
+GLAD_FUNC_VOID(glVDPAUFiniNV, PFNGLVDPAUFININVPROC, (void), ())
+GLAD_FUNC_VOID(glVDPAUGetSurfaceivNV, PFNGLVDPAUGETSURFACEIVNVPROC, (GLvdpauSurfaceNV surface, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (surface, pname, count, length, values))
+GLAD_FUNC_VOID(glVDPAUInitNV, PFNGLVDPAUINITNVPROC, (const void *vdpDevice, const void *getProcAddress), (vdpDevice, getProcAddress))
+GLAD_FUNC(GLboolean, glVDPAUIsSurfaceNV, PFNGLVDPAUISSURFACENVPROC, (GLvdpauSurfaceNV surface), (surface))
+GLAD_FUNC_VOID(glVDPAUMapSurfacesNV, PFNGLVDPAUMAPSURFACESNVPROC, (GLsizei numSurfaces, const GLvdpauSurfaceNV *surfaces), (numSurfaces, surfaces))
+GLAD_FUNC(GLvdpauSurfaceNV, glVDPAURegisterOutputSurfaceNV, PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames), (vdpSurface, target, numTextureNames, textureNames))
+GLAD_FUNC(GLvdpauSurfaceNV, glVDPAURegisterVideoSurfaceNV, PFNGLVDPAUREGISTERVIDEOSURFACENVPROC, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames), (vdpSurface, target, numTextureNames, textureNames))
+GLAD_FUNC(GLvdpauSurfaceNV, glVDPAURegisterVideoSurfaceWithPictureStructureNV, PFNGLVDPAUREGISTERVIDEOSURFACEWITHPICTURESTRUCTURENVPROC, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames, GLboolean isFrameStructure), (vdpSurface, target, numTextureNames, textureNames, isFrameStructure))
+GLAD_FUNC_VOID(glVDPAUSurfaceAccessNV, PFNGLVDPAUSURFACEACCESSNVPROC, (GLvdpauSurfaceNV surface, GLenum access), (surface, access))
+GLAD_FUNC_VOID(glVDPAUUnmapSurfacesNV, PFNGLVDPAUUNMAPSURFACESNVPROC, (GLsizei numSurface, const GLvdpauSurfaceNV *surfaces), (numSurface, surfaces))
+GLAD_FUNC_VOID(glVDPAUUnregisterSurfaceNV, PFNGLVDPAUUNREGISTERSURFACENVPROC, (GLvdpauSurfaceNV surface), (surface))
+GLAD_FUNC_VOID(glValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program))
+GLAD_FUNC_VOID(glValidateProgramARB, PFNGLVALIDATEPROGRAMARBPROC, (GLhandleARB programObj), (programObj))
+GLAD_FUNC_VOID(glValidateProgramPipeline, PFNGLVALIDATEPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline))
+GLAD_FUNC_VOID(glValidateProgramPipelineEXT, PFNGLVALIDATEPROGRAMPIPELINEEXTPROC, (GLuint pipeline), (pipeline))
+GLAD_FUNC_VOID(glVariantArrayObjectATI, PFNGLVARIANTARRAYOBJECTATIPROC, (GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset), (id, type, stride, buffer, offset))
+GLAD_FUNC_VOID(glVariantPointerEXT, PFNGLVARIANTPOINTEREXTPROC, (GLuint id, GLenum type, GLuint stride, const void *addr), (id, type, stride, addr))
+GLAD_FUNC_VOID(glVariantbvEXT, PFNGLVARIANTBVEXTPROC, (GLuint id, const GLbyte *addr), (id, addr))
+GLAD_FUNC_VOID(glVariantdvEXT, PFNGLVARIANTDVEXTPROC, (GLuint id, const GLdouble *addr), (id, addr))
+GLAD_FUNC_VOID(glVariantfvEXT, PFNGLVARIANTFVEXTPROC, (GLuint id, const GLfloat *addr), (id, addr))
+GLAD_FUNC_VOID(glVariantivEXT, PFNGLVARIANTIVEXTPROC, (GLuint id, const GLint *addr), (id, addr))
+GLAD_FUNC_VOID(glVariantsvEXT, PFNGLVARIANTSVEXTPROC, (GLuint id, const GLshort *addr), (id, addr))
+GLAD_FUNC_VOID(glVariantubvEXT, PFNGLVARIANTUBVEXTPROC, (GLuint id, const GLubyte *addr), (id, addr))
+GLAD_FUNC_VOID(glVariantuivEXT, PFNGLVARIANTUIVEXTPROC, (GLuint id, const GLuint *addr), (id, addr))
+GLAD_FUNC_VOID(glVariantusvEXT, PFNGLVARIANTUSVEXTPROC, (GLuint id, const GLushort *addr), (id, addr))
+GLAD_FUNC_VOID(glVertex2bOES, PFNGLVERTEX2BOESPROC, (GLbyte x, GLbyte y), (x, y))
+GLAD_FUNC_VOID(glVertex2bvOES, PFNGLVERTEX2BVOESPROC, (const GLbyte *coords), (coords))
+GLAD_FUNC_VOID(glVertex2hNV, PFNGLVERTEX2HNVPROC, (GLhalfNV x, GLhalfNV y), (x, y))
+GLAD_FUNC_VOID(glVertex2hvNV, PFNGLVERTEX2HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glVertex2xOES, PFNGLVERTEX2XOESPROC, (GLfixed x), (x))
+GLAD_FUNC_VOID(glVertex2xvOES, PFNGLVERTEX2XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glVertex3bOES, PFNGLVERTEX3BOESPROC, (GLbyte x, GLbyte y, GLbyte z), (x, y, z))
+GLAD_FUNC_VOID(glVertex3bvOES, PFNGLVERTEX3BVOESPROC, (const GLbyte *coords), (coords))
+GLAD_FUNC_VOID(glVertex3hNV, PFNGLVERTEX3HNVPROC, (GLhalfNV x, GLhalfNV y, GLhalfNV z), (x, y, z))
+GLAD_FUNC_VOID(glVertex3hvNV, PFNGLVERTEX3HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glVertex3xOES, PFNGLVERTEX3XOESPROC, (GLfixed x, GLfixed y), (x, y))
+GLAD_FUNC_VOID(glVertex3xvOES, PFNGLVERTEX3XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glVertex4bOES, PFNGLVERTEX4BOESPROC, (GLbyte x, GLbyte y, GLbyte z, GLbyte w), (x, y, z, w))
+GLAD_FUNC_VOID(glVertex4bvOES, PFNGLVERTEX4BVOESPROC, (const GLbyte *coords), (coords))
+GLAD_FUNC_VOID(glVertex4hNV, PFNGLVERTEX4HNVPROC, (GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w), (x, y, z, w))
+GLAD_FUNC_VOID(glVertex4hvNV, PFNGLVERTEX4HVNVPROC, (const GLhalfNV *v), (v))
+GLAD_FUNC_VOID(glVertex4xOES, PFNGLVERTEX4XOESPROC, (GLfixed x, GLfixed y, GLfixed z), (x, y, z))
+GLAD_FUNC_VOID(glVertex4xvOES, PFNGLVERTEX4XVOESPROC, (const GLfixed *coords), (coords))
+GLAD_FUNC_VOID(glVertexArrayAttribBinding, PFNGLVERTEXARRAYATTRIBBINDINGPROC, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+GLAD_FUNC_VOID(glVertexArrayAttribFormat, PFNGLVERTEXARRAYATTRIBFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+GLAD_FUNC_VOID(glVertexArrayAttribIFormat, PFNGLVERTEXARRAYATTRIBIFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_FUNC_VOID(glVertexArrayAttribLFormat, PFNGLVERTEXARRAYATTRIBLFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_FUNC_VOID(glVertexArrayBindVertexBufferEXT, PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+GLAD_FUNC_VOID(glVertexArrayBindingDivisor, PFNGLVERTEXARRAYBINDINGDIVISORPROC, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+GLAD_FUNC_VOID(glVertexArrayColorOffsetEXT, PFNGLVERTEXARRAYCOLOROFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayEdgeFlagOffsetEXT, PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLsizei stride, GLintptr offset), (vaobj, buffer, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayElementBuffer, PFNGLVERTEXARRAYELEMENTBUFFERPROC, (GLuint vaobj, GLuint buffer), (vaobj, buffer))
+GLAD_FUNC_VOID(glVertexArrayFogCoordOffsetEXT, PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayIndexOffsetEXT, PFNGLVERTEXARRAYINDEXOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayMultiTexCoordOffsetEXT, PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLenum texunit, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, texunit, size, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayNormalOffsetEXT, PFNGLVERTEXARRAYNORMALOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayParameteriAPPLE, PFNGLVERTEXARRAYPARAMETERIAPPLEPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glVertexArrayRangeAPPLE, PFNGLVERTEXARRAYRANGEAPPLEPROC, (GLsizei length, void *pointer), (length, pointer))
+GLAD_FUNC_VOID(glVertexArrayRangeNV, PFNGLVERTEXARRAYRANGENVPROC, (GLsizei length, const void *pointer), (length, pointer))
+GLAD_FUNC_VOID(glVertexArraySecondaryColorOffsetEXT, PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayTexCoordOffsetEXT, PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayVertexAttribBindingEXT, PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+GLAD_FUNC_VOID(glVertexArrayVertexAttribDivisorEXT, PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC, (GLuint vaobj, GLuint index, GLuint divisor), (vaobj, index, divisor))
+GLAD_FUNC_VOID(glVertexArrayVertexAttribFormatEXT, PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+GLAD_FUNC_VOID(glVertexArrayVertexAttribIFormatEXT, PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_FUNC_VOID(glVertexArrayVertexAttribIOffsetEXT, PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayVertexAttribLFormatEXT, PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_FUNC_VOID(glVertexArrayVertexAttribLOffsetEXT, PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayVertexAttribOffsetEXT, PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, normalized, stride, offset))
+GLAD_FUNC_VOID(glVertexArrayVertexBindingDivisorEXT, PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+GLAD_FUNC_VOID(glVertexArrayVertexBuffer, PFNGLVERTEXARRAYVERTEXBUFFERPROC, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+GLAD_FUNC_VOID(glVertexArrayVertexBuffers, PFNGLVERTEXARRAYVERTEXBUFFERSPROC, (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides))
+GLAD_FUNC_VOID(glVertexArrayVertexOffsetEXT, PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset))
+GLAD_FUNC_VOID(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1dARB, PFNGLVERTEXATTRIB1DARBPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1dNV, PFNGLVERTEXATTRIB1DNVPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1dvARB, PFNGLVERTEXATTRIB1DVARBPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1dvNV, PFNGLVERTEXATTRIB1DVNVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1fARB, PFNGLVERTEXATTRIB1FARBPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1fNV, PFNGLVERTEXATTRIB1FNVPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1fvARB, PFNGLVERTEXATTRIB1FVARBPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1fvNV, PFNGLVERTEXATTRIB1FVNVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1hNV, PFNGLVERTEXATTRIB1HNVPROC, (GLuint index, GLhalfNV x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1hvNV, PFNGLVERTEXATTRIB1HVNVPROC, (GLuint index, const GLhalfNV *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1sARB, PFNGLVERTEXATTRIB1SARBPROC, (GLuint index, GLshort x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1sNV, PFNGLVERTEXATTRIB1SNVPROC, (GLuint index, GLshort x), (index, x))
+GLAD_FUNC_VOID(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1svARB, PFNGLVERTEXATTRIB1SVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib1svNV, PFNGLVERTEXATTRIB1SVNVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2dARB, PFNGLVERTEXATTRIB2DARBPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2dNV, PFNGLVERTEXATTRIB2DNVPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2dvARB, PFNGLVERTEXATTRIB2DVARBPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2dvNV, PFNGLVERTEXATTRIB2DVNVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2fARB, PFNGLVERTEXATTRIB2FARBPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2fNV, PFNGLVERTEXATTRIB2FNVPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2fvARB, PFNGLVERTEXATTRIB2FVARBPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2fvNV, PFNGLVERTEXATTRIB2FVNVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2hNV, PFNGLVERTEXATTRIB2HNVPROC, (GLuint index, GLhalfNV x, GLhalfNV y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2hvNV, PFNGLVERTEXATTRIB2HVNVPROC, (GLuint index, const GLhalfNV *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2sARB, PFNGLVERTEXATTRIB2SARBPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2sNV, PFNGLVERTEXATTRIB2SNVPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2svARB, PFNGLVERTEXATTRIB2SVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib2svNV, PFNGLVERTEXATTRIB2SVNVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3dARB, PFNGLVERTEXATTRIB3DARBPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3dNV, PFNGLVERTEXATTRIB3DNVPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3dvARB, PFNGLVERTEXATTRIB3DVARBPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3dvNV, PFNGLVERTEXATTRIB3DVNVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3fARB, PFNGLVERTEXATTRIB3FARBPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3fNV, PFNGLVERTEXATTRIB3FNVPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3fvARB, PFNGLVERTEXATTRIB3FVARBPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3fvNV, PFNGLVERTEXATTRIB3FVNVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3hNV, PFNGLVERTEXATTRIB3HNVPROC, (GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3hvNV, PFNGLVERTEXATTRIB3HVNVPROC, (GLuint index, const GLhalfNV *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3sARB, PFNGLVERTEXATTRIB3SARBPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3sNV, PFNGLVERTEXATTRIB3SNVPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3svARB, PFNGLVERTEXATTRIB3SVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib3svNV, PFNGLVERTEXATTRIB3SVNVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4NbvARB, PFNGLVERTEXATTRIB4NBVARBPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4NivARB, PFNGLVERTEXATTRIB4NIVARBPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4NsvARB, PFNGLVERTEXATTRIB4NSVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4NubARB, PFNGLVERTEXATTRIB4NUBARBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4NubvARB, PFNGLVERTEXATTRIB4NUBVARBPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4NuivARB, PFNGLVERTEXATTRIB4NUIVARBPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4NusvARB, PFNGLVERTEXATTRIB4NUSVARBPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4bvARB, PFNGLVERTEXATTRIB4BVARBPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4dARB, PFNGLVERTEXATTRIB4DARBPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4dNV, PFNGLVERTEXATTRIB4DNVPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4dvARB, PFNGLVERTEXATTRIB4DVARBPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4dvNV, PFNGLVERTEXATTRIB4DVNVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4fARB, PFNGLVERTEXATTRIB4FARBPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4fNV, PFNGLVERTEXATTRIB4FNVPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4fvARB, PFNGLVERTEXATTRIB4FVARBPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4fvNV, PFNGLVERTEXATTRIB4FVNVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4hNV, PFNGLVERTEXATTRIB4HNVPROC, (GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4hvNV, PFNGLVERTEXATTRIB4HVNVPROC, (GLuint index, const GLhalfNV *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4ivARB, PFNGLVERTEXATTRIB4IVARBPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4sARB, PFNGLVERTEXATTRIB4SARBPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4sNV, PFNGLVERTEXATTRIB4SNVPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4svARB, PFNGLVERTEXATTRIB4SVARBPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4svNV, PFNGLVERTEXATTRIB4SVNVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4ubNV, PFNGLVERTEXATTRIB4UBNVPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4ubvARB, PFNGLVERTEXATTRIB4UBVARBPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4ubvNV, PFNGLVERTEXATTRIB4UBVNVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4uivARB, PFNGLVERTEXATTRIB4UIVARBPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttrib4usvARB, PFNGLVERTEXATTRIB4USVARBPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribArrayObjectATI, PFNGLVERTEXATTRIBARRAYOBJECTATIPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset), (index, size, type, normalized, stride, buffer, offset))
+GLAD_FUNC_VOID(glVertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex))
+GLAD_FUNC_VOID(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_FUNC_VOID(glVertexAttribDivisorARB, PFNGLVERTEXATTRIBDIVISORARBPROC, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_FUNC_VOID(glVertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset))
+GLAD_FUNC_VOID(glVertexAttribFormatNV, PFNGLVERTEXATTRIBFORMATNVPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride), (index, size, type, normalized, stride))
+GLAD_FUNC_VOID(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribI1iEXT, PFNGLVERTEXATTRIBI1IEXTPROC, (GLuint index, GLint x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI1ivEXT, PFNGLVERTEXATTRIBI1IVEXTPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribI1uiEXT, PFNGLVERTEXATTRIBI1UIEXTPROC, (GLuint index, GLuint x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI1uivEXT, PFNGLVERTEXATTRIBI1UIVEXTPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttribI2iEXT, PFNGLVERTEXATTRIBI2IEXTPROC, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI2ivEXT, PFNGLVERTEXATTRIBI2IVEXTPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttribI2uiEXT, PFNGLVERTEXATTRIBI2UIEXTPROC, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI2uivEXT, PFNGLVERTEXATTRIBI2UIVEXTPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttribI3iEXT, PFNGLVERTEXATTRIBI3IEXTPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI3ivEXT, PFNGLVERTEXATTRIBI3IVEXTPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttribI3uiEXT, PFNGLVERTEXATTRIBI3UIEXTPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI3uivEXT, PFNGLVERTEXATTRIBI3UIVEXTPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4bvEXT, PFNGLVERTEXATTRIBI4BVEXTPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttribI4iEXT, PFNGLVERTEXATTRIBI4IEXTPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4ivEXT, PFNGLVERTEXATTRIBI4IVEXTPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4svEXT, PFNGLVERTEXATTRIBI4SVEXTPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4ubvEXT, PFNGLVERTEXATTRIBI4UBVEXTPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttribI4uiEXT, PFNGLVERTEXATTRIBI4UIEXTPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4uivEXT, PFNGLVERTEXATTRIBI4UIVEXTPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribI4usvEXT, PFNGLVERTEXATTRIBI4USVEXTPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GLAD_FUNC_VOID(glVertexAttribIFormatNV, PFNGLVERTEXATTRIBIFORMATNVPROC, (GLuint index, GLint size, GLenum type, GLsizei stride), (index, size, type, stride))
+GLAD_FUNC_VOID(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_FUNC_VOID(glVertexAttribIPointerEXT, PFNGLVERTEXATTRIBIPOINTEREXTPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_FUNC_VOID(glVertexAttribL1d, PFNGLVERTEXATTRIBL1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribL1dEXT, PFNGLVERTEXATTRIBL1DEXTPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribL1dv, PFNGLVERTEXATTRIBL1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL1dvEXT, PFNGLVERTEXATTRIBL1DVEXTPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL1i64NV, PFNGLVERTEXATTRIBL1I64NVPROC, (GLuint index, GLint64EXT x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribL1i64vNV, PFNGLVERTEXATTRIBL1I64VNVPROC, (GLuint index, const GLint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL1ui64ARB, PFNGLVERTEXATTRIBL1UI64ARBPROC, (GLuint index, GLuint64EXT x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribL1ui64NV, PFNGLVERTEXATTRIBL1UI64NVPROC, (GLuint index, GLuint64EXT x), (index, x))
+GLAD_FUNC_VOID(glVertexAttribL1ui64vARB, PFNGLVERTEXATTRIBL1UI64VARBPROC, (GLuint index, const GLuint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL1ui64vNV, PFNGLVERTEXATTRIBL1UI64VNVPROC, (GLuint index, const GLuint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL2d, PFNGLVERTEXATTRIBL2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttribL2dEXT, PFNGLVERTEXATTRIBL2DEXTPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttribL2dv, PFNGLVERTEXATTRIBL2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL2dvEXT, PFNGLVERTEXATTRIBL2DVEXTPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL2i64NV, PFNGLVERTEXATTRIBL2I64NVPROC, (GLuint index, GLint64EXT x, GLint64EXT y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttribL2i64vNV, PFNGLVERTEXATTRIBL2I64VNVPROC, (GLuint index, const GLint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL2ui64NV, PFNGLVERTEXATTRIBL2UI64NVPROC, (GLuint index, GLuint64EXT x, GLuint64EXT y), (index, x, y))
+GLAD_FUNC_VOID(glVertexAttribL2ui64vNV, PFNGLVERTEXATTRIBL2UI64VNVPROC, (GLuint index, const GLuint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL3d, PFNGLVERTEXATTRIBL3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttribL3dEXT, PFNGLVERTEXATTRIBL3DEXTPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttribL3dv, PFNGLVERTEXATTRIBL3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL3dvEXT, PFNGLVERTEXATTRIBL3DVEXTPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL3i64NV, PFNGLVERTEXATTRIBL3I64NVPROC, (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttribL3i64vNV, PFNGLVERTEXATTRIBL3I64VNVPROC, (GLuint index, const GLint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL3ui64NV, PFNGLVERTEXATTRIBL3UI64NVPROC, (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (index, x, y, z))
+GLAD_FUNC_VOID(glVertexAttribL3ui64vNV, PFNGLVERTEXATTRIBL3UI64VNVPROC, (GLuint index, const GLuint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL4d, PFNGLVERTEXATTRIBL4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttribL4dEXT, PFNGLVERTEXATTRIBL4DEXTPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttribL4dv, PFNGLVERTEXATTRIBL4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL4dvEXT, PFNGLVERTEXATTRIBL4DVEXTPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL4i64NV, PFNGLVERTEXATTRIBL4I64NVPROC, (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttribL4i64vNV, PFNGLVERTEXATTRIBL4I64VNVPROC, (GLuint index, const GLint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribL4ui64NV, PFNGLVERTEXATTRIBL4UI64NVPROC, (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (index, x, y, z, w))
+GLAD_FUNC_VOID(glVertexAttribL4ui64vNV, PFNGLVERTEXATTRIBL4UI64VNVPROC, (GLuint index, const GLuint64EXT *v), (index, v))
+GLAD_FUNC_VOID(glVertexAttribLFormat, PFNGLVERTEXATTRIBLFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GLAD_FUNC_VOID(glVertexAttribLFormatNV, PFNGLVERTEXATTRIBLFORMATNVPROC, (GLuint index, GLint size, GLenum type, GLsizei stride), (index, size, type, stride))
+GLAD_FUNC_VOID(glVertexAttribLPointer, PFNGLVERTEXATTRIBLPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_FUNC_VOID(glVertexAttribLPointerEXT, PFNGLVERTEXATTRIBLPOINTEREXTPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_FUNC_VOID(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_FUNC_VOID(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_FUNC_VOID(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_FUNC_VOID(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_FUNC_VOID(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_FUNC_VOID(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_FUNC_VOID(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_FUNC_VOID(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_FUNC_VOID(glVertexAttribParameteriAMD, PFNGLVERTEXATTRIBPARAMETERIAMDPROC, (GLuint index, GLenum pname, GLint param), (index, pname, param))
+GLAD_FUNC_VOID(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_FUNC_VOID(glVertexAttribPointerARB, PFNGLVERTEXATTRIBPOINTERARBPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_FUNC_VOID(glVertexAttribPointerNV, PFNGLVERTEXATTRIBPOINTERNVPROC, (GLuint index, GLint fsize, GLenum type, GLsizei stride, const void *pointer), (index, fsize, type, stride, pointer))
+GLAD_FUNC_VOID(glVertexAttribs1dvNV, PFNGLVERTEXATTRIBS1DVNVPROC, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs1fvNV, PFNGLVERTEXATTRIBS1FVNVPROC, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs1hvNV, PFNGLVERTEXATTRIBS1HVNVPROC, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v))
+GLAD_FUNC_VOID(glVertexAttribs1svNV, PFNGLVERTEXATTRIBS1SVNVPROC, (GLuint index, GLsizei count, const GLshort *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs2dvNV, PFNGLVERTEXATTRIBS2DVNVPROC, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs2fvNV, PFNGLVERTEXATTRIBS2FVNVPROC, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs2hvNV, PFNGLVERTEXATTRIBS2HVNVPROC, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v))
+GLAD_FUNC_VOID(glVertexAttribs2svNV, PFNGLVERTEXATTRIBS2SVNVPROC, (GLuint index, GLsizei count, const GLshort *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs3dvNV, PFNGLVERTEXATTRIBS3DVNVPROC, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs3fvNV, PFNGLVERTEXATTRIBS3FVNVPROC, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs3hvNV, PFNGLVERTEXATTRIBS3HVNVPROC, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v))
+GLAD_FUNC_VOID(glVertexAttribs3svNV, PFNGLVERTEXATTRIBS3SVNVPROC, (GLuint index, GLsizei count, const GLshort *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs4dvNV, PFNGLVERTEXATTRIBS4DVNVPROC, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs4fvNV, PFNGLVERTEXATTRIBS4FVNVPROC, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs4hvNV, PFNGLVERTEXATTRIBS4HVNVPROC, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v))
+GLAD_FUNC_VOID(glVertexAttribs4svNV, PFNGLVERTEXATTRIBS4SVNVPROC, (GLuint index, GLsizei count, const GLshort *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexAttribs4ubvNV, PFNGLVERTEXATTRIBS4UBVNVPROC, (GLuint index, GLsizei count, const GLubyte *v), (index, count, v))
+GLAD_FUNC_VOID(glVertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor))
+GLAD_FUNC_VOID(glVertexBlendARB, PFNGLVERTEXBLENDARBPROC, (GLint count), (count))
+GLAD_FUNC_VOID(glVertexBlendEnvfATI, PFNGLVERTEXBLENDENVFATIPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_FUNC_VOID(glVertexBlendEnviATI, PFNGLVERTEXBLENDENVIATIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_FUNC_VOID(glVertexFormatNV, PFNGLVERTEXFORMATNVPROC, (GLint size, GLenum type, GLsizei stride), (size, type, stride))
+GLAD_FUNC_VOID(glVertexP2ui, PFNGLVERTEXP2UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_FUNC_VOID(glVertexP2uiv, PFNGLVERTEXP2UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_FUNC_VOID(glVertexP3ui, PFNGLVERTEXP3UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_FUNC_VOID(glVertexP3uiv, PFNGLVERTEXP3UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_FUNC_VOID(glVertexP4ui, PFNGLVERTEXP4UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_FUNC_VOID(glVertexP4uiv, PFNGLVERTEXP4UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_FUNC_VOID(glVertexPointerEXT, PFNGLVERTEXPOINTEREXTPROC, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer))
+GLAD_FUNC_VOID(glVertexPointerListIBM, PFNGLVERTEXPOINTERLISTIBMPROC, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride))
+GLAD_FUNC_VOID(glVertexPointervINTEL, PFNGLVERTEXPOINTERVINTELPROC, (GLint size, GLenum type, const void **pointer), (size, type, pointer))
+GLAD_FUNC_VOID(glVertexStream1dATI, PFNGLVERTEXSTREAM1DATIPROC, (GLenum stream, GLdouble x), (stream, x))
+GLAD_FUNC_VOID(glVertexStream1dvATI, PFNGLVERTEXSTREAM1DVATIPROC, (GLenum stream, const GLdouble *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream1fATI, PFNGLVERTEXSTREAM1FATIPROC, (GLenum stream, GLfloat x), (stream, x))
+GLAD_FUNC_VOID(glVertexStream1fvATI, PFNGLVERTEXSTREAM1FVATIPROC, (GLenum stream, const GLfloat *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream1iATI, PFNGLVERTEXSTREAM1IATIPROC, (GLenum stream, GLint x), (stream, x))
+GLAD_FUNC_VOID(glVertexStream1ivATI, PFNGLVERTEXSTREAM1IVATIPROC, (GLenum stream, const GLint *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream1sATI, PFNGLVERTEXSTREAM1SATIPROC, (GLenum stream, GLshort x), (stream, x))
+GLAD_FUNC_VOID(glVertexStream1svATI, PFNGLVERTEXSTREAM1SVATIPROC, (GLenum stream, const GLshort *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream2dATI, PFNGLVERTEXSTREAM2DATIPROC, (GLenum stream, GLdouble x, GLdouble y), (stream, x, y))
+GLAD_FUNC_VOID(glVertexStream2dvATI, PFNGLVERTEXSTREAM2DVATIPROC, (GLenum stream, const GLdouble *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream2fATI, PFNGLVERTEXSTREAM2FATIPROC, (GLenum stream, GLfloat x, GLfloat y), (stream, x, y))
+GLAD_FUNC_VOID(glVertexStream2fvATI, PFNGLVERTEXSTREAM2FVATIPROC, (GLenum stream, const GLfloat *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream2iATI, PFNGLVERTEXSTREAM2IATIPROC, (GLenum stream, GLint x, GLint y), (stream, x, y))
+GLAD_FUNC_VOID(glVertexStream2ivATI, PFNGLVERTEXSTREAM2IVATIPROC, (GLenum stream, const GLint *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream2sATI, PFNGLVERTEXSTREAM2SATIPROC, (GLenum stream, GLshort x, GLshort y), (stream, x, y))
+GLAD_FUNC_VOID(glVertexStream2svATI, PFNGLVERTEXSTREAM2SVATIPROC, (GLenum stream, const GLshort *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream3dATI, PFNGLVERTEXSTREAM3DATIPROC, (GLenum stream, GLdouble x, GLdouble y, GLdouble z), (stream, x, y, z))
+GLAD_FUNC_VOID(glVertexStream3dvATI, PFNGLVERTEXSTREAM3DVATIPROC, (GLenum stream, const GLdouble *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream3fATI, PFNGLVERTEXSTREAM3FATIPROC, (GLenum stream, GLfloat x, GLfloat y, GLfloat z), (stream, x, y, z))
+GLAD_FUNC_VOID(glVertexStream3fvATI, PFNGLVERTEXSTREAM3FVATIPROC, (GLenum stream, const GLfloat *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream3iATI, PFNGLVERTEXSTREAM3IATIPROC, (GLenum stream, GLint x, GLint y, GLint z), (stream, x, y, z))
+GLAD_FUNC_VOID(glVertexStream3ivATI, PFNGLVERTEXSTREAM3IVATIPROC, (GLenum stream, const GLint *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream3sATI, PFNGLVERTEXSTREAM3SATIPROC, (GLenum stream, GLshort x, GLshort y, GLshort z), (stream, x, y, z))
+GLAD_FUNC_VOID(glVertexStream3svATI, PFNGLVERTEXSTREAM3SVATIPROC, (GLenum stream, const GLshort *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream4dATI, PFNGLVERTEXSTREAM4DATIPROC, (GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (stream, x, y, z, w))
+GLAD_FUNC_VOID(glVertexStream4dvATI, PFNGLVERTEXSTREAM4DVATIPROC, (GLenum stream, const GLdouble *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream4fATI, PFNGLVERTEXSTREAM4FATIPROC, (GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (stream, x, y, z, w))
+GLAD_FUNC_VOID(glVertexStream4fvATI, PFNGLVERTEXSTREAM4FVATIPROC, (GLenum stream, const GLfloat *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream4iATI, PFNGLVERTEXSTREAM4IATIPROC, (GLenum stream, GLint x, GLint y, GLint z, GLint w), (stream, x, y, z, w))
+GLAD_FUNC_VOID(glVertexStream4ivATI, PFNGLVERTEXSTREAM4IVATIPROC, (GLenum stream, const GLint *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexStream4sATI, PFNGLVERTEXSTREAM4SATIPROC, (GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w), (stream, x, y, z, w))
+GLAD_FUNC_VOID(glVertexStream4svATI, PFNGLVERTEXSTREAM4SVATIPROC, (GLenum stream, const GLshort *coords), (stream, coords))
+GLAD_FUNC_VOID(glVertexWeightPointerEXT, PFNGLVERTEXWEIGHTPOINTEREXTPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_FUNC_VOID(glVertexWeightfEXT, PFNGLVERTEXWEIGHTFEXTPROC, (GLfloat weight), (weight))
+GLAD_FUNC_VOID(glVertexWeightfvEXT, PFNGLVERTEXWEIGHTFVEXTPROC, (const GLfloat *weight), (weight))
+GLAD_FUNC_VOID(glVertexWeighthNV, PFNGLVERTEXWEIGHTHNVPROC, (GLhalfNV weight), (weight))
+GLAD_FUNC_VOID(glVertexWeighthvNV, PFNGLVERTEXWEIGHTHVNVPROC, (const GLhalfNV *weight), (weight))
+GLAD_FUNC(GLenum, glVideoCaptureNV, PFNGLVIDEOCAPTURENVPROC, (GLuint video_capture_slot, GLuint *sequence_num, GLuint64EXT *capture_time), (video_capture_slot, sequence_num, capture_time))
+GLAD_FUNC_VOID(glVideoCaptureStreamParameterdvNV, PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLdouble *params), (video_capture_slot, stream, pname, params))
+GLAD_FUNC_VOID(glVideoCaptureStreamParameterfvNV, PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLfloat *params), (video_capture_slot, stream, pname, params))
+GLAD_FUNC_VOID(glVideoCaptureStreamParameterivNV, PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLint *params), (video_capture_slot, stream, pname, params))
+GLAD_FUNC_VOID(glViewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_FUNC_VOID(glViewportArrayv, PFNGLVIEWPORTARRAYVPROC, (GLuint first, GLsizei count, const GLfloat *v), (first, count, v))
+GLAD_FUNC_VOID(glViewportIndexedf, PFNGLVIEWPORTINDEXEDFPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h))
+GLAD_FUNC_VOID(glViewportIndexedfv, PFNGLVIEWPORTINDEXEDFVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_FUNC_VOID(glViewportPositionWScaleNV, PFNGLVIEWPORTPOSITIONWSCALENVPROC, (GLuint index, GLfloat xcoeff, GLfloat ycoeff), (index, xcoeff, ycoeff))
+GLAD_FUNC_VOID(glViewportSwizzleNV, PFNGLVIEWPORTSWIZZLENVPROC, (GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew), (index, swizzlex, swizzley, swizzlez, swizzlew))
+GLAD_FUNC_VOID(glWaitSemaphoreEXT, PFNGLWAITSEMAPHOREEXTPROC, (GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts), (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts))
+GLAD_FUNC_VOID(glWaitSemaphoreui64NVX, PFNGLWAITSEMAPHOREUI64NVXPROC, (GLuint waitGpu, GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (waitGpu, fenceObjectCount, semaphoreArray, fenceValueArray))
+GLAD_FUNC_VOID(glWaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_FUNC_VOID(glWaitVkSemaphoreNV, PFNGLWAITVKSEMAPHORENVPROC, (GLuint64 vkSemaphore), (vkSemaphore))
+GLAD_FUNC_VOID(glWeightPathsNV, PFNGLWEIGHTPATHSNVPROC, (GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights), (resultPath, numPaths, paths, weights))
+GLAD_FUNC_VOID(glWeightPointerARB, PFNGLWEIGHTPOINTERARBPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GLAD_FUNC_VOID(glWeightbvARB, PFNGLWEIGHTBVARBPROC, (GLint size, const GLbyte *weights), (size, weights))
+GLAD_FUNC_VOID(glWeightdvARB, PFNGLWEIGHTDVARBPROC, (GLint size, const GLdouble *weights), (size, weights))
+GLAD_FUNC_VOID(glWeightfvARB, PFNGLWEIGHTFVARBPROC, (GLint size, const GLfloat *weights), (size, weights))
+GLAD_FUNC_VOID(glWeightivARB, PFNGLWEIGHTIVARBPROC, (GLint size, const GLint *weights), (size, weights))
+GLAD_FUNC_VOID(glWeightsvARB, PFNGLWEIGHTSVARBPROC, (GLint size, const GLshort *weights), (size, weights))
+GLAD_FUNC_VOID(glWeightubvARB, PFNGLWEIGHTUBVARBPROC, (GLint size, const GLubyte *weights), (size, weights))
+GLAD_FUNC_VOID(glWeightuivARB, PFNGLWEIGHTUIVARBPROC, (GLint size, const GLuint *weights), (size, weights))
+GLAD_FUNC_VOID(glWeightusvARB, PFNGLWEIGHTUSVARBPROC, (GLint size, const GLushort *weights), (size, weights))
+GLAD_FUNC_VOID(glWindowPos2dARB, PFNGLWINDOWPOS2DARBPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_FUNC_VOID(glWindowPos2dMESA, PFNGLWINDOWPOS2DMESAPROC, (GLdouble x, GLdouble y), (x, y))
+GLAD_FUNC_VOID(glWindowPos2dvARB, PFNGLWINDOWPOS2DVARBPROC, (const GLdouble *v), (v))
+GLAD_FUNC_VOID(glWindowPos2dvMESA, PFNGLWINDOWPOS2DVMESAPROC, (const GLdouble *v), (v))
+GLAD_FUNC_VOID(glWindowPos2fARB, PFNGLWINDOWPOS2FARBPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_FUNC_VOID(glWindowPos2fMESA, PFNGLWINDOWPOS2FMESAPROC, (GLfloat x, GLfloat y), (x, y))
+GLAD_FUNC_VOID(glWindowPos2fvARB, PFNGLWINDOWPOS2FVARBPROC, (const GLfloat *v), (v))
+GLAD_FUNC_VOID(glWindowPos2fvMESA, PFNGLWINDOWPOS2FVMESAPROC, (const GLfloat *v), (v))
+GLAD_FUNC_VOID(glWindowPos2iARB, PFNGLWINDOWPOS2IARBPROC, (GLint x, GLint y), (x, y))
+GLAD_FUNC_VOID(glWindowPos2iMESA, PFNGLWINDOWPOS2IMESAPROC, (GLint x, GLint y), (x, y))
+GLAD_FUNC_VOID(glWindowPos2ivARB, PFNGLWINDOWPOS2IVARBPROC, (const GLint *v), (v))
+GLAD_FUNC_VOID(glWindowPos2ivMESA, PFNGLWINDOWPOS2IVMESAPROC, (const GLint *v), (v))
+GLAD_FUNC_VOID(glWindowPos2sARB, PFNGLWINDOWPOS2SARBPROC, (GLshort x, GLshort y), (x, y))
+GLAD_FUNC_VOID(glWindowPos2sMESA, PFNGLWINDOWPOS2SMESAPROC, (GLshort x, GLshort y), (x, y))
+GLAD_FUNC_VOID(glWindowPos2svARB, PFNGLWINDOWPOS2SVARBPROC, (const GLshort *v), (v))
+GLAD_FUNC_VOID(glWindowPos2svMESA, PFNGLWINDOWPOS2SVMESAPROC, (const GLshort *v), (v))
+GLAD_FUNC_VOID(glWindowPos3dARB, PFNGLWINDOWPOS3DARBPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_FUNC_VOID(glWindowPos3dMESA, PFNGLWINDOWPOS3DMESAPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GLAD_FUNC_VOID(glWindowPos3dvARB, PFNGLWINDOWPOS3DVARBPROC, (const GLdouble *v), (v))
+GLAD_FUNC_VOID(glWindowPos3dvMESA, PFNGLWINDOWPOS3DVMESAPROC, (const GLdouble *v), (v))
+GLAD_FUNC_VOID(glWindowPos3fARB, PFNGLWINDOWPOS3FARBPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_FUNC_VOID(glWindowPos3fMESA, PFNGLWINDOWPOS3FMESAPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GLAD_FUNC_VOID(glWindowPos3fvARB, PFNGLWINDOWPOS3FVARBPROC, (const GLfloat *v), (v))
+GLAD_FUNC_VOID(glWindowPos3fvMESA, PFNGLWINDOWPOS3FVMESAPROC, (const GLfloat *v), (v))
+GLAD_FUNC_VOID(glWindowPos3iARB, PFNGLWINDOWPOS3IARBPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_FUNC_VOID(glWindowPos3iMESA, PFNGLWINDOWPOS3IMESAPROC, (GLint x, GLint y, GLint z), (x, y, z))
+GLAD_FUNC_VOID(glWindowPos3ivARB, PFNGLWINDOWPOS3IVARBPROC, (const GLint *v), (v))
+GLAD_FUNC_VOID(glWindowPos3ivMESA, PFNGLWINDOWPOS3IVMESAPROC, (const GLint *v), (v))
+GLAD_FUNC_VOID(glWindowPos3sARB, PFNGLWINDOWPOS3SARBPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_FUNC_VOID(glWindowPos3sMESA, PFNGLWINDOWPOS3SMESAPROC, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GLAD_FUNC_VOID(glWindowPos3svARB, PFNGLWINDOWPOS3SVARBPROC, (const GLshort *v), (v))
+GLAD_FUNC_VOID(glWindowPos3svMESA, PFNGLWINDOWPOS3SVMESAPROC, (const GLshort *v), (v))
+GLAD_FUNC_VOID(glWindowPos4dMESA, PFNGLWINDOWPOS4DMESAPROC, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w))
+GLAD_FUNC_VOID(glWindowPos4dvMESA, PFNGLWINDOWPOS4DVMESAPROC, (const GLdouble *v), (v))
+GLAD_FUNC_VOID(glWindowPos4fMESA, PFNGLWINDOWPOS4FMESAPROC, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w))
+GLAD_FUNC_VOID(glWindowPos4fvMESA, PFNGLWINDOWPOS4FVMESAPROC, (const GLfloat *v), (v))
+GLAD_FUNC_VOID(glWindowPos4iMESA, PFNGLWINDOWPOS4IMESAPROC, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w))
+GLAD_FUNC_VOID(glWindowPos4ivMESA, PFNGLWINDOWPOS4IVMESAPROC, (const GLint *v), (v))
+GLAD_FUNC_VOID(glWindowPos4sMESA, PFNGLWINDOWPOS4SMESAPROC, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w))
+GLAD_FUNC_VOID(glWindowPos4svMESA, PFNGLWINDOWPOS4SVMESAPROC, (const GLshort *v), (v))
+GLAD_FUNC_VOID(glWindowRectanglesEXT, PFNGLWINDOWRECTANGLESEXTPROC, (GLenum mode, GLsizei count, const GLint *box), (mode, count, box))
+GLAD_FUNC_VOID(glWriteMaskEXT, PFNGLWRITEMASKEXTPROC, (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW), (res, in, outX, outY, outZ, outW))
@@ -0,0 +1,54 @@
+/*
+
+    Shared helper for the glad companion layers that account texture
+    uploads (glad_mock.c, glad_trace.c). Internal, not installed.
+
+*/
+
+#ifndef __glad_image_h_
+#define __glad_image_h_
+
+#include <glad/glad.h>
+
+/* Bytes of client memory read for a width x height x depth image, ignoring
+ * unpack row alignment. */
+static GLuint64 glad_image_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type) {
+    GLuint64 components;
+    GLuint64 texel;
+
+    if(width <= 0 || height <= 0 || depth <= 0) return 0;
+
+    switch(format) {
+        case GL_RG: case GL_RG_INTEGER:
+            components = 2; break;
+        case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+            components = 3; break;
+        case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+            components = 4; break;
+        default:
+            components = 1; break;
+    }
+
+    switch(type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE:
+            texel = components; break;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+            texel = components * 2; break;
+        case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+            texel = components * 4; break;
+        case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+            texel = 1; break;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+        case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+        case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+            texel = 2; break;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+            texel = 8; break;
+        default:
+            texel = 4; break;
+    }
+
+    return texel * (GLuint64)width * (GLuint64)height * (GLuint64)depth;
+}
+
+#endif
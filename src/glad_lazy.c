@@ -0,0 +1,84 @@
+/*
+
+    Lazy GL function pointer resolution for glad.
+
+    gladLoadGLLoaderLazy() runs the normal version and extension detection,
+    but instead of looking every entry point up through the loader it points
+    each glad_gl* pointer at a trampoline. The first call through a pointer
+    resolves the real symbol, patches the pointer and forwards the call, so
+    only functions the client actually uses are ever looked up.
+
+    Pointers for versions and extensions the context does not support stay
+    NULL, as with gladLoadGLLoader(). Every other pointer is non-NULL even if
+    the loader turns out not to have the symbol; such a call does nothing
+    and returns zero.
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad.h>
+
+static GLADloadproc lazy_load = NULL;
+
+/* The resolved symbol is also kept next to the trampoline: a layer such as
+ * glad_trace.c may have wrapped the glad pointer and saved the trampoline
+ * as its target, in which case only an unwrapped pointer is patched and the
+ * trampoline keeps forwarding without looking the symbol up again. A symbol
+ * the loader does not have leaves the trampoline in place. */
+#define GLAD_FUNC(ret, name, pfn, params, args) \
+    static pfn lazy_real_##name = NULL; \
+    static ret APIENTRY glad_lazy_##name params { \
+        if(lazy_real_##name == NULL) lazy_real_##name = (pfn)lazy_load(#name); \
+        if(lazy_real_##name == NULL) return (ret)0; \
+        if(glad_##name == glad_lazy_##name) glad_##name = lazy_real_##name; \
+        return lazy_real_##name args; \
+    }
+#define GLAD_FUNC_VOID(name, pfn, params, args) \
+    static pfn lazy_real_##name = NULL; \
+    static void APIENTRY glad_lazy_##name params { \
+        if(lazy_real_##name == NULL) lazy_real_##name = (pfn)lazy_load(#name); \
+        if(lazy_real_##name == NULL) return; \
+        if(glad_##name == glad_lazy_##name) glad_##name = lazy_real_##name; \
+        lazy_real_##name args; \
+    }
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+
+struct glad_lazy_entry {
+    const char *name;
+    void *trampoline;
+};
+
+static const struct glad_lazy_entry lazy_entries[] = {
+#define GLAD_FUNC(ret, name, pfn, params, args) { #name, (void*)glad_lazy_##name },
+#define GLAD_FUNC_VOID(name, pfn, params, args) { #name, (void*)glad_lazy_##name },
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+};
+
+static int compare_entry(const void *key, const void *entry) {
+    return strcmp((const char *)key, ((const struct glad_lazy_entry *)entry)->name);
+}
+
+static void* get_trampoline(const char *name) {
+    const struct glad_lazy_entry *entry = (const struct glad_lazy_entry *)bsearch(name,
+        lazy_entries, sizeof(lazy_entries) / sizeof(lazy_entries[0]),
+        sizeof(lazy_entries[0]), compare_entry);
+    return entry != NULL ? entry->trampoline : NULL;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+    if(load == NULL) return 0;
+    lazy_load = load;
+
+#define GLAD_FUNC(ret, name, pfn, params, args) lazy_real_##name = NULL;
+#define GLAD_FUNC_VOID(name, pfn, params, args) lazy_real_##name = NULL;
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+
+    return gladLoadGLLoader(&get_trampoline);
+}
@@ -0,0 +1,900 @@
+/*
+
+    Null GL backend for glad, see glad/glad_mock.h.
+
+    Every entry point in glad_funcs.h gets a generic stub that counts the
+    call and returns zero. The handful of functions the loader and a typical
+    renderer depend on for sane results (context queries, object names,
+    shader status, mapping, uploads) are overridden below, as are the glGet*
+    queries such a renderer makes. Context state in mock_state is written in
+    full, as every value of a multi-valued pname; any other pname reads as a
+    single zero. Object, program and uniform queries read as zero or empty.
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad.h>
+#include <glad/glad_mock.h>
+#include "glad_image.h"
+
+enum glad_mock_func {
+#define GLAD_FUNC(ret, name, pfn, params, args) MOCK_##name,
+#define GLAD_FUNC_VOID(name, pfn, params, args) MOCK_##name,
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+    MOCK_FUNC_COUNT
+};
+
+static unsigned long mock_calls[MOCK_FUNC_COUNT];
+static GLuint mock_next_name = 1;
+static unsigned long mock_objects_created = 0;
+static GLuint64 mock_buffer_alloc_bytes = 0;
+static GLuint64 mock_buffer_upload_bytes = 0;
+static GLuint64 mock_texture_upload_bytes = 0;
+
+static const char *const *mock_exts = NULL;
+static int mock_num_exts = 0;
+
+/* Buffers are indexed by name. Each mapping is its own allocation, so a
+ * pointer stays valid until its buffer is unmapped, respecified or deleted,
+ * as in GL. */
+struct glad_mock_buffer {
+    GLsizeiptr size;
+    void *map;
+};
+
+static struct glad_mock_buffer *mock_buffers = NULL;
+static GLuint mock_buffers_size = 0;
+
+static const GLenum mock_buffer_targets[] = {
+    GL_ARRAY_BUFFER,
+    GL_ELEMENT_ARRAY_BUFFER,
+    GL_UNIFORM_BUFFER,
+    GL_COPY_READ_BUFFER,
+    GL_COPY_WRITE_BUFFER,
+    GL_PIXEL_PACK_BUFFER,
+    GL_PIXEL_UNPACK_BUFFER,
+    GL_TEXTURE_BUFFER,
+    GL_TRANSFORM_FEEDBACK_BUFFER,
+    GL_DRAW_INDIRECT_BUFFER,
+    GL_DISPATCH_INDIRECT_BUFFER,
+    GL_SHADER_STORAGE_BUFFER,
+    GL_ATOMIC_COUNTER_BUFFER,
+    GL_QUERY_BUFFER
+};
+#define MOCK_BUFFER_TARGETS (sizeof(mock_buffer_targets) / sizeof(mock_buffer_targets[0]))
+
+static GLuint mock_bound_buffers[MOCK_BUFFER_TARGETS];
+
+struct glad_mock_location {
+    GLuint program;
+    GLint location;
+    char *name;
+};
+
+static struct glad_mock_location *mock_locations = NULL;
+static size_t mock_num_locations = 0;
+static size_t mock_locations_size = 0;
+
+#define MOCK_COUNT(name) (mock_calls[MOCK_##name]++)
+
+/* The generic stubs ignore their arguments. */
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#elif defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4100)
+#endif
+
+#define GLAD_FUNC(ret, name, pfn, params, args) \
+    static ret APIENTRY glad_mock_##name params { \
+        mock_calls[MOCK_##name]++; \
+        return (ret)0; \
+    }
+#define GLAD_FUNC_VOID(name, pfn, params, args) \
+    static void APIENTRY glad_mock_##name params { \
+        mock_calls[MOCK_##name]++; \
+    }
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+static void gen_names(GLsizei n, GLuint *names) {
+    GLsizei index;
+    if(names == NULL) return;
+    for(index = 0; index < n; index++) {
+        names[index] = mock_next_name++;
+    }
+    mock_objects_created += (unsigned long)(n > 0 ? n : 0);
+}
+
+static GLuint create_name(void) {
+    mock_objects_created++;
+    return mock_next_name++;
+}
+
+static struct glad_mock_buffer* find_buffer(GLuint name) {
+    if(name == 0) return NULL;
+    if(name >= mock_buffers_size) {
+        GLuint size = mock_buffers_size > 0 ? mock_buffers_size : 256;
+        struct glad_mock_buffer *grown;
+        while(size <= name) size *= 2;
+        grown = (struct glad_mock_buffer *)realloc(mock_buffers, size * sizeof(*grown));
+        if(grown == NULL) return NULL;
+        memset(grown + mock_buffers_size, 0, (size - mock_buffers_size) * sizeof(*grown));
+        mock_buffers = grown;
+        mock_buffers_size = size;
+    }
+    return &mock_buffers[name];
+}
+
+static GLuint* bound_buffer(GLenum target) {
+    size_t index;
+    for(index = 0; index < MOCK_BUFFER_TARGETS; index++) {
+        if(mock_buffer_targets[index] == target) return &mock_bound_buffers[index];
+    }
+    return NULL;
+}
+
+static struct glad_mock_buffer* target_buffer(GLenum target) {
+    GLuint *binding = bound_buffer(target);
+    return binding != NULL ? find_buffer(*binding) : NULL;
+}
+
+static GLboolean unmap_buffer(struct glad_mock_buffer *buffer) {
+    if(buffer == NULL || buffer->map == NULL) return GL_FALSE;
+    free(buffer->map);
+    buffer->map = NULL;
+    return GL_TRUE;
+}
+
+/* Respecifying a buffer unmaps it. */
+static void buffer_data(struct glad_mock_buffer *buffer, GLsizeiptr size, const void *data) {
+    if(size <= 0) return;
+    mock_buffer_alloc_bytes += (GLuint64)size;
+    if(data != NULL) mock_buffer_upload_bytes += (GLuint64)size;
+    if(buffer == NULL) return;
+    unmap_buffer(buffer);
+    buffer->size = size;
+}
+
+/* A buffer can only be mapped once at a time, like in GL. */
+static void* map_buffer(struct glad_mock_buffer *buffer, GLsizeiptr length) {
+    if(buffer == NULL || buffer->map != NULL) return NULL;
+    buffer->map = malloc(length > 0 ? (size_t)length : 1);
+    return buffer->map;
+}
+
+static const GLubyte * APIENTRY mock_glGetString(GLenum name) {
+    MOCK_COUNT(glGetString);
+    switch(name) {
+        case GL_VENDOR: return (const GLubyte *)"glad";
+        case GL_RENDERER: return (const GLubyte *)"glad mock";
+        case GL_VERSION: return (const GLubyte *)"3.3.0 glad mock";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"3.30";
+        default: return NULL;
+    }
+}
+
+static const GLubyte * APIENTRY mock_glGetStringi(GLenum name, GLuint index) {
+    MOCK_COUNT(glGetStringi);
+    if(name != GL_EXTENSIONS || index >= (GLuint)mock_num_exts) return NULL;
+    return (const GLubyte *)mock_exts[index];
+}
+
+struct glad_mock_state {
+    GLenum pname;
+    int count;
+    GLint value[4];
+};
+
+/* Context state, as returned by every glGet*v form. Limits are typical of
+ * a current desktop driver rather than the GL minimums. */
+static const struct glad_mock_state mock_state[] = {
+    { GL_MAJOR_VERSION, 1, { 3 } },
+    { GL_MINOR_VERSION, 1, { 3 } },
+    { GL_CONTEXT_PROFILE_MASK, 1, { GL_CONTEXT_CORE_PROFILE_BIT } },
+    { GL_DOUBLEBUFFER, 1, { GL_TRUE } },
+    { GL_VIEWPORT, 4, { 0, 0, 0, 0 } },
+    { GL_SCISSOR_BOX, 4, { 0, 0, 0, 0 } },
+    { GL_COLOR_CLEAR_VALUE, 4, { 0, 0, 0, 0 } },
+    { GL_BLEND_COLOR, 4, { 0, 0, 0, 0 } },
+    { GL_COLOR_WRITEMASK, 4, { GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE } },
+    { GL_DEPTH_RANGE, 2, { 0, 1 } },
+    { GL_MAX_VIEWPORT_DIMS, 2, { 16384, 16384 } },
+    { GL_ALIASED_LINE_WIDTH_RANGE, 2, { 1, 1 } },
+    { GL_SMOOTH_LINE_WIDTH_RANGE, 2, { 1, 1 } },
+    { GL_POINT_SIZE_RANGE, 2, { 1, 64 } },
+    { GL_MAX_TEXTURE_SIZE, 1, { 16384 } },
+    { GL_MAX_3D_TEXTURE_SIZE, 1, { 2048 } },
+    { GL_MAX_ARRAY_TEXTURE_LAYERS, 1, { 2048 } },
+    { GL_MAX_CUBE_MAP_TEXTURE_SIZE, 1, { 16384 } },
+    { GL_MAX_RENDERBUFFER_SIZE, 1, { 16384 } },
+    { GL_MAX_TEXTURE_BUFFER_SIZE, 1, { 134217728 } },
+    { GL_MAX_TEXTURE_LOD_BIAS, 1, { 16 } },
+    { GL_MAX_TEXTURE_MAX_ANISOTROPY, 1, { 16 } },
+    { GL_MAX_TEXTURE_IMAGE_UNITS, 1, { 32 } },
+    { GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, 1, { 32 } },
+    { GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, 1, { 80 } },
+    { GL_MAX_VERTEX_ATTRIBS, 1, { 16 } },
+    { GL_MAX_VERTEX_ATTRIB_BINDINGS, 1, { 16 } },
+    { GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET, 1, { 2047 } },
+    { GL_MAX_ELEMENTS_VERTICES, 1, { 1048576 } },
+    { GL_MAX_ELEMENTS_INDICES, 1, { 1048576 } },
+    { GL_MAX_VERTEX_UNIFORM_COMPONENTS, 1, { 4096 } },
+    { GL_MAX_FRAGMENT_UNIFORM_COMPONENTS, 1, { 4096 } },
+    { GL_MAX_VARYING_COMPONENTS, 1, { 124 } },
+    { GL_MAX_VERTEX_OUTPUT_COMPONENTS, 1, { 128 } },
+    { GL_MAX_FRAGMENT_INPUT_COMPONENTS, 1, { 128 } },
+    { GL_MAX_GEOMETRY_OUTPUT_VERTICES, 1, { 256 } },
+    { GL_MAX_CLIP_DISTANCES, 1, { 8 } },
+    { GL_MAX_UNIFORM_BUFFER_BINDINGS, 1, { 84 } },
+    { GL_MAX_UNIFORM_BLOCK_SIZE, 1, { 65536 } },
+    { GL_MAX_VERTEX_UNIFORM_BLOCKS, 1, { 14 } },
+    { GL_MAX_GEOMETRY_UNIFORM_BLOCKS, 1, { 14 } },
+    { GL_MAX_FRAGMENT_UNIFORM_BLOCKS, 1, { 14 } },
+    { GL_MAX_COMBINED_UNIFORM_BLOCKS, 1, { 70 } },
+    { GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, 1, { 256 } },
+    { GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, 1, { 16 } },
+    { GL_MAX_SHADER_STORAGE_BLOCK_SIZE, 1, { 134217728 } },
+    { GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, 1, { 256 } },
+    { GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, 1, { 256 } },
+    { GL_MIN_MAP_BUFFER_ALIGNMENT, 1, { 64 } },
+    { GL_MAX_COMPUTE_SHARED_MEMORY_SIZE, 1, { 32768 } },
+    { GL_MAX_COLOR_ATTACHMENTS, 1, { 8 } },
+    { GL_MAX_DRAW_BUFFERS, 1, { 8 } },
+    { GL_MAX_SAMPLES, 1, { 8 } },
+    { GL_MAX_COLOR_TEXTURE_SAMPLES, 1, { 8 } },
+    { GL_MAX_DEPTH_TEXTURE_SAMPLES, 1, { 8 } },
+    { GL_MAX_INTEGER_SAMPLES, 1, { 8 } },
+    { GL_MAX_VIEWPORTS, 1, { 16 } },
+    { GL_MAX_DEBUG_MESSAGE_LENGTH, 1, { 1024 } },
+    { GL_MAX_DEBUG_LOGGED_MESSAGES, 1, { 64 } },
+    { GL_MAX_LABEL_LENGTH, 1, { 256 } }
+};
+
+/* Fills values with the state of pname and returns how many there are. */
+static int get_state(GLenum pname, GLint *values) {
+    size_t index;
+    values[0] = 0;
+    if(pname == GL_NUM_EXTENSIONS) {
+        values[0] = mock_num_exts;
+        return 1;
+    }
+    for(index = 0; index < sizeof(mock_state) / sizeof(mock_state[0]); index++) {
+        if(mock_state[index].pname == pname) {
+            memcpy(values, mock_state[index].value, sizeof(mock_state[index].value));
+            return mock_state[index].count;
+        }
+    }
+    return 1;
+}
+
+#define MOCK_GET_STATE(name, type, convert) \
+    static void APIENTRY mock_##name(GLenum pname, type *data) { \
+        GLint values[4]; \
+        int count; \
+        int index; \
+        mock_calls[MOCK_##name]++; \
+        if(data == NULL) return; \
+        count = get_state(pname, values); \
+        for(index = 0; index < count; index++) data[index] = convert(values[index]); \
+    }
+#define MOCK_AS_IS(value) (value)
+#define MOCK_AS_FLOAT(value) ((GLfloat)(value))
+#define MOCK_AS_DOUBLE(value) ((GLdouble)(value))
+#define MOCK_AS_BOOLEAN(value) ((value) != 0 ? GL_TRUE : GL_FALSE)
+MOCK_GET_STATE(glGetIntegerv, GLint, MOCK_AS_IS)
+MOCK_GET_STATE(glGetInteger64v, GLint64, MOCK_AS_IS)
+MOCK_GET_STATE(glGetBooleanv, GLboolean, MOCK_AS_BOOLEAN)
+MOCK_GET_STATE(glGetFloatv, GLfloat, MOCK_AS_FLOAT)
+MOCK_GET_STATE(glGetDoublev, GLdouble, MOCK_AS_DOUBLE)
+#undef MOCK_GET_STATE
+#undef MOCK_AS_IS
+#undef MOCK_AS_FLOAT
+#undef MOCK_AS_DOUBLE
+#undef MOCK_AS_BOOLEAN
+
+/* Indexed state (glGet*i_v) always reads as zero. */
+#define MOCK_GET_INDEXED(name, type) \
+    static void APIENTRY mock_##name(GLenum target, GLuint index, type *data) { \
+        (void)target; (void)index; \
+        mock_calls[MOCK_##name]++; \
+        if(data != NULL) *data = 0; \
+    }
+MOCK_GET_INDEXED(glGetBooleani_v, GLboolean)
+MOCK_GET_INDEXED(glGetIntegeri_v, GLint)
+MOCK_GET_INDEXED(glGetInteger64i_v, GLint64)
+MOCK_GET_INDEXED(glGetFloati_v, GLfloat)
+MOCK_GET_INDEXED(glGetDoublei_v, GLdouble)
+#undef MOCK_GET_INDEXED
+
+/* Object parameters read as zero, except that query results are always
+ * available so polling loops finish. */
+#define MOCK_GET_PARAMETER(name, object, type) \
+    static void APIENTRY mock_##name(object target, GLenum pname, type *params) { \
+        (void)target; \
+        mock_calls[MOCK_##name]++; \
+        if(params != NULL) *params = (type)(pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); \
+    }
+MOCK_GET_PARAMETER(glGetBufferParameteriv, GLenum, GLint)
+MOCK_GET_PARAMETER(glGetBufferParameteri64v, GLenum, GLint64)
+MOCK_GET_PARAMETER(glGetQueryiv, GLenum, GLint)
+MOCK_GET_PARAMETER(glGetQueryObjectiv, GLuint, GLint)
+MOCK_GET_PARAMETER(glGetQueryObjectuiv, GLuint, GLuint)
+MOCK_GET_PARAMETER(glGetQueryObjecti64v, GLuint, GLint64)
+MOCK_GET_PARAMETER(glGetQueryObjectui64v, GLuint, GLuint64)
+MOCK_GET_PARAMETER(glGetRenderbufferParameteriv, GLenum, GLint)
+MOCK_GET_PARAMETER(glGetSamplerParameteriv, GLuint, GLint)
+MOCK_GET_PARAMETER(glGetSamplerParameterfv, GLuint, GLfloat)
+MOCK_GET_PARAMETER(glGetTexParameteriv, GLenum, GLint)
+MOCK_GET_PARAMETER(glGetTexParameterfv, GLenum, GLfloat)
+MOCK_GET_PARAMETER(glGetVertexAttribiv, GLuint, GLint)
+MOCK_GET_PARAMETER(glGetVertexAttribfv, GLuint, GLfloat)
+MOCK_GET_PARAMETER(glGetProgramPipelineiv, GLuint, GLint)
+#undef MOCK_GET_PARAMETER
+
+/* Uniform values are not kept. Only the first component is written, since
+ * the size of the uniform is unknown. */
+#define MOCK_GET_UNIFORM(name, type) \
+    static void APIENTRY mock_##name(GLuint program, GLint location, type *params) { \
+        (void)program; (void)location; \
+        mock_calls[MOCK_##name]++; \
+        if(params != NULL) *params = 0; \
+    }
+MOCK_GET_UNIFORM(glGetUniformiv, GLint)
+MOCK_GET_UNIFORM(glGetUniformuiv, GLuint)
+MOCK_GET_UNIFORM(glGetUniformfv, GLfloat)
+MOCK_GET_UNIFORM(glGetUniformdv, GLdouble)
+#undef MOCK_GET_UNIFORM
+
+/* Logs and sources are always empty. */
+#define MOCK_GET_STRING(name) \
+    static void APIENTRY mock_##name(GLuint object, GLsizei bufSize, GLsizei *length, GLchar *string) { \
+        (void)object; \
+        mock_calls[MOCK_##name]++; \
+        if(length != NULL) *length = 0; \
+        if(string != NULL && bufSize > 0) string[0] = '\0'; \
+    }
+MOCK_GET_STRING(glGetShaderInfoLog)
+MOCK_GET_STRING(glGetShaderSource)
+MOCK_GET_STRING(glGetProgramInfoLog)
+MOCK_GET_STRING(glGetProgramPipelineInfoLog)
+#undef MOCK_GET_STRING
+
+static void APIENTRY mock_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    (void)target; (void)attachment; (void)pname;
+    MOCK_COUNT(glGetFramebufferAttachmentParameteriv);
+    if(params != NULL) *params = 0;
+}
+
+static void APIENTRY mock_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    (void)target; (void)level; (void)pname;
+    MOCK_COUNT(glGetTexLevelParameteriv);
+    if(params != NULL) *params = 0;
+}
+
+static void APIENTRY mock_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    (void)target; (void)level; (void)pname;
+    MOCK_COUNT(glGetTexLevelParameterfv);
+    if(params != NULL) *params = 0;
+}
+
+static void APIENTRY mock_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+    GLsizei index;
+    (void)target; (void)internalformat; (void)pname;
+    MOCK_COUNT(glGetInternalformativ);
+    if(params == NULL) return;
+    for(index = 0; index < count; index++) params[index] = 0;
+}
+
+static void APIENTRY mock_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    int integer = precisiontype == GL_LOW_INT || precisiontype == GL_MEDIUM_INT || precisiontype == GL_HIGH_INT;
+    (void)shadertype;
+    MOCK_COUNT(glGetShaderPrecisionFormat);
+    if(range != NULL) {
+        range[0] = integer ? 31 : 127;
+        range[1] = integer ? 30 : 127;
+    }
+    if(precision != NULL) *precision = integer ? 0 : 23;
+}
+
+/* Programs report no active uniforms, attributes or blocks (see
+ * glGetProgramiv), so per-index queries describe an empty variable. */
+static void APIENTRY mock_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    (void)program; (void)index;
+    MOCK_COUNT(glGetActiveUniform);
+    if(length != NULL) *length = 0;
+    if(size != NULL) *size = 0;
+    if(type != NULL) *type = 0;
+    if(name != NULL && bufSize > 0) name[0] = '\0';
+}
+
+static void APIENTRY mock_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    (void)program; (void)index;
+    MOCK_COUNT(glGetActiveAttrib);
+    if(length != NULL) *length = 0;
+    if(size != NULL) *size = 0;
+    if(type != NULL) *type = 0;
+    if(name != NULL && bufSize > 0) name[0] = '\0';
+}
+
+#define MOCK_GET_INDEXED_NAME(name) \
+    static void APIENTRY mock_##name(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *string) { \
+        (void)program; (void)index; \
+        mock_calls[MOCK_##name]++; \
+        if(length != NULL) *length = 0; \
+        if(string != NULL && bufSize > 0) string[0] = '\0'; \
+    }
+MOCK_GET_INDEXED_NAME(glGetActiveUniformName)
+MOCK_GET_INDEXED_NAME(glGetActiveUniformBlockName)
+#undef MOCK_GET_INDEXED_NAME
+
+static void APIENTRY mock_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    (void)program; (void)uniformBlockIndex; (void)pname;
+    MOCK_COUNT(glGetActiveUniformBlockiv);
+    if(params != NULL) *params = 0;
+}
+
+static void APIENTRY mock_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    GLsizei index;
+    (void)program; (void)uniformIndices; (void)pname;
+    MOCK_COUNT(glGetActiveUniformsiv);
+    if(params == NULL) return;
+    for(index = 0; index < uniformCount; index++) params[index] = 0;
+}
+
+static void APIENTRY mock_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    GLsizei index;
+    (void)program; (void)uniformNames;
+    MOCK_COUNT(glGetUniformIndices);
+    if(uniformIndices == NULL) return;
+    for(index = 0; index < uniformCount; index++) uniformIndices[index] = GL_INVALID_INDEX;
+}
+
+static void APIENTRY mock_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    (void)program; (void)bufSize; (void)binary;
+    MOCK_COUNT(glGetProgramBinary);
+    if(length != NULL) *length = 0;
+    if(binaryFormat != NULL) *binaryFormat = 0;
+}
+
+static void APIENTRY mock_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+    (void)sync;
+    MOCK_COUNT(glGetSynciv);
+    if(length != NULL) *length = count > 0 ? 1 : 0;
+    if(values != NULL && count > 0) *values = pname == GL_SYNC_STATUS ? GL_SIGNALED : 0;
+}
+
+static GLenum APIENTRY mock_glCheckFramebufferStatus(GLenum target) {
+    (void)target;
+    MOCK_COUNT(glCheckFramebufferStatus);
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+#define MOCK_GEN(name) \
+    static void APIENTRY mock_##name(GLsizei n, GLuint *names) { \
+        mock_calls[MOCK_##name]++; \
+        gen_names(n, names); \
+    }
+MOCK_GEN(glGenBuffers)
+MOCK_GEN(glGenVertexArrays)
+MOCK_GEN(glGenTextures)
+MOCK_GEN(glGenFramebuffers)
+MOCK_GEN(glGenRenderbuffers)
+MOCK_GEN(glGenQueries)
+MOCK_GEN(glGenSamplers)
+MOCK_GEN(glGenTransformFeedbacks)
+MOCK_GEN(glGenProgramPipelines)
+MOCK_GEN(glCreateBuffers)
+MOCK_GEN(glCreateVertexArrays)
+MOCK_GEN(glCreateFramebuffers)
+MOCK_GEN(glCreateRenderbuffers)
+MOCK_GEN(glCreateSamplers)
+MOCK_GEN(glCreateTransformFeedbacks)
+MOCK_GEN(glCreateProgramPipelines)
+#undef MOCK_GEN
+
+#define MOCK_CREATE_TARGET(name) \
+    static void APIENTRY mock_##name(GLenum target, GLsizei n, GLuint *names) { \
+        (void)target; \
+        mock_calls[MOCK_##name]++; \
+        gen_names(n, names); \
+    }
+MOCK_CREATE_TARGET(glCreateTextures)
+MOCK_CREATE_TARGET(glCreateQueries)
+#undef MOCK_CREATE_TARGET
+
+static GLuint APIENTRY mock_glCreateShader(GLenum type) {
+    (void)type;
+    MOCK_COUNT(glCreateShader);
+    return create_name();
+}
+
+static GLuint APIENTRY mock_glCreateProgram(void) {
+    MOCK_COUNT(glCreateProgram);
+    return create_name();
+}
+
+static void APIENTRY mock_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    (void)shader;
+    MOCK_COUNT(glGetShaderiv);
+    if(params == NULL) return;
+    *params = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+}
+
+static void APIENTRY mock_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    (void)program;
+    MOCK_COUNT(glGetProgramiv);
+    if(params == NULL) return;
+    *params = (pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS) ? GL_TRUE : 0;
+}
+
+/* Each program numbers its uniforms in the order they are first asked
+ * for, and asking again returns the same location. */
+static GLint APIENTRY mock_glGetUniformLocation(GLuint program, const GLchar *name) {
+    struct glad_mock_location *entry;
+    size_t index;
+    size_t len;
+    GLint location = 0;
+
+    MOCK_COUNT(glGetUniformLocation);
+    if(name == NULL) return -1;
+
+    for(index = 0; index < mock_num_locations; index++) {
+        entry = &mock_locations[index];
+        if(entry->program != program) continue;
+        if(strcmp(entry->name, name) == 0) return entry->location;
+        location++;
+    }
+
+    if(mock_num_locations == mock_locations_size) {
+        size_t size = mock_locations_size > 0 ? mock_locations_size * 2 : 64;
+        entry = (struct glad_mock_location *)realloc(mock_locations, size * sizeof(*entry));
+        if(entry == NULL) return -1;
+        mock_locations = entry;
+        mock_locations_size = size;
+    }
+
+    len = strlen(name) + 1;
+    entry = &mock_locations[mock_num_locations];
+    entry->name = (char *)malloc(len);
+    if(entry->name == NULL) return -1;
+    memcpy(entry->name, name, len);
+    entry->program = program;
+    entry->location = location;
+    mock_num_locations++;
+    return location;
+}
+
+static GLint APIENTRY mock_glGetAttribLocation(GLuint program, const GLchar *name) {
+    (void)program; (void)name;
+    MOCK_COUNT(glGetAttribLocation);
+    return 0;
+}
+
+static void APIENTRY mock_glBindBuffer(GLenum target, GLuint buffer) {
+    GLuint *binding = bound_buffer(target);
+    MOCK_COUNT(glBindBuffer);
+    if(binding != NULL) *binding = buffer;
+}
+
+static void APIENTRY mock_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    GLuint *binding = bound_buffer(target);
+    (void)index;
+    MOCK_COUNT(glBindBufferBase);
+    if(binding != NULL) *binding = buffer;
+}
+
+static void APIENTRY mock_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    GLuint *binding = bound_buffer(target);
+    (void)index; (void)offset; (void)size;
+    MOCK_COUNT(glBindBufferRange);
+    if(binding != NULL) *binding = buffer;
+}
+
+static void APIENTRY mock_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    GLsizei index;
+    size_t target;
+    MOCK_COUNT(glDeleteBuffers);
+    if(buffers == NULL) return;
+    for(index = 0; index < n; index++) {
+        if(buffers[index] == 0 || buffers[index] >= mock_buffers_size) continue;
+        unmap_buffer(&mock_buffers[buffers[index]]);
+        mock_buffers[buffers[index]].size = 0;
+        for(target = 0; target < MOCK_BUFFER_TARGETS; target++) {
+            if(mock_bound_buffers[target] == buffers[index]) mock_bound_buffers[target] = 0;
+        }
+    }
+}
+
+static void APIENTRY mock_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    (void)usage;
+    MOCK_COUNT(glBufferData);
+    buffer_data(target_buffer(target), size, data);
+}
+
+static void APIENTRY mock_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    (void)flags;
+    MOCK_COUNT(glBufferStorage);
+    buffer_data(target_buffer(target), size, data);
+}
+
+static void APIENTRY mock_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+    (void)usage;
+    MOCK_COUNT(glNamedBufferData);
+    buffer_data(find_buffer(buffer), size, data);
+}
+
+static void APIENTRY mock_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+    (void)flags;
+    MOCK_COUNT(glNamedBufferStorage);
+    buffer_data(find_buffer(buffer), size, data);
+}
+
+static void APIENTRY mock_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    (void)target; (void)offset;
+    MOCK_COUNT(glBufferSubData);
+    if(size > 0 && data != NULL) mock_buffer_upload_bytes += (GLuint64)size;
+}
+
+static void APIENTRY mock_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+    (void)buffer; (void)offset;
+    MOCK_COUNT(glNamedBufferSubData);
+    if(size > 0 && data != NULL) mock_buffer_upload_bytes += (GLuint64)size;
+}
+
+static void * APIENTRY mock_glMapBuffer(GLenum target, GLenum access) {
+    struct glad_mock_buffer *buffer = target_buffer(target);
+    (void)access;
+    MOCK_COUNT(glMapBuffer);
+    return map_buffer(buffer, buffer != NULL ? buffer->size : 0);
+}
+
+static void * APIENTRY mock_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    (void)offset; (void)access;
+    MOCK_COUNT(glMapBufferRange);
+    return map_buffer(target_buffer(target), length);
+}
+
+static void * APIENTRY mock_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    struct glad_mock_buffer *entry = find_buffer(buffer);
+    (void)access;
+    MOCK_COUNT(glMapNamedBuffer);
+    return map_buffer(entry, entry != NULL ? entry->size : 0);
+}
+
+static void * APIENTRY mock_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    (void)offset; (void)access;
+    MOCK_COUNT(glMapNamedBufferRange);
+    return map_buffer(find_buffer(buffer), length);
+}
+
+static GLboolean APIENTRY mock_glUnmapBuffer(GLenum target) {
+    MOCK_COUNT(glUnmapBuffer);
+    return unmap_buffer(target_buffer(target));
+}
+
+static GLboolean APIENTRY mock_glUnmapNamedBuffer(GLuint buffer) {
+    MOCK_COUNT(glUnmapNamedBuffer);
+    return unmap_buffer(find_buffer(buffer));
+}
+
+static void APIENTRY mock_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    (void)target; (void)level; (void)internalformat; (void)border;
+    MOCK_COUNT(glTexImage2D);
+    if(pixels != NULL) mock_texture_upload_bytes += glad_image_size(width, height, 1, format, type);
+}
+
+static void APIENTRY mock_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    (void)target; (void)level; (void)xoffset; (void)yoffset;
+    MOCK_COUNT(glTexSubImage2D);
+    if(pixels != NULL) mock_texture_upload_bytes += glad_image_size(width, height, 1, format, type);
+}
+
+static void APIENTRY mock_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    (void)target; (void)level; (void)internalformat; (void)border;
+    MOCK_COUNT(glTexImage3D);
+    if(pixels != NULL) mock_texture_upload_bytes += glad_image_size(width, height, depth, format, type);
+}
+
+static void APIENTRY mock_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    (void)target; (void)level; (void)xoffset; (void)yoffset; (void)zoffset;
+    MOCK_COUNT(glTexSubImage3D);
+    if(pixels != NULL) mock_texture_upload_bytes += glad_image_size(width, height, depth, format, type);
+}
+
+static GLsync APIENTRY mock_glFenceSync(GLenum condition, GLbitfield flags) {
+    (void)condition; (void)flags;
+    MOCK_COUNT(glFenceSync);
+    return (GLsync)&mock_next_name;
+}
+
+static GLenum APIENTRY mock_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    (void)sync; (void)flags; (void)timeout;
+    MOCK_COUNT(glClientWaitSync);
+    return GL_ALREADY_SIGNALED;
+}
+
+struct glad_mock_entry {
+    const char *name;
+    void *proc;
+};
+
+/* Sorted by name in strcmp() order. */
+static const struct glad_mock_entry mock_overrides[] = {
+    { "glBindBuffer", (void*)mock_glBindBuffer },
+    { "glBindBufferBase", (void*)mock_glBindBufferBase },
+    { "glBindBufferRange", (void*)mock_glBindBufferRange },
+    { "glBufferData", (void*)mock_glBufferData },
+    { "glBufferStorage", (void*)mock_glBufferStorage },
+    { "glBufferSubData", (void*)mock_glBufferSubData },
+    { "glCheckFramebufferStatus", (void*)mock_glCheckFramebufferStatus },
+    { "glClientWaitSync", (void*)mock_glClientWaitSync },
+    { "glCreateBuffers", (void*)mock_glCreateBuffers },
+    { "glCreateFramebuffers", (void*)mock_glCreateFramebuffers },
+    { "glCreateProgram", (void*)mock_glCreateProgram },
+    { "glCreateProgramPipelines", (void*)mock_glCreateProgramPipelines },
+    { "glCreateQueries", (void*)mock_glCreateQueries },
+    { "glCreateRenderbuffers", (void*)mock_glCreateRenderbuffers },
+    { "glCreateSamplers", (void*)mock_glCreateSamplers },
+    { "glCreateShader", (void*)mock_glCreateShader },
+    { "glCreateTextures", (void*)mock_glCreateTextures },
+    { "glCreateTransformFeedbacks", (void*)mock_glCreateTransformFeedbacks },
+    { "glCreateVertexArrays", (void*)mock_glCreateVertexArrays },
+    { "glDeleteBuffers", (void*)mock_glDeleteBuffers },
+    { "glFenceSync", (void*)mock_glFenceSync },
+    { "glGenBuffers", (void*)mock_glGenBuffers },
+    { "glGenFramebuffers", (void*)mock_glGenFramebuffers },
+    { "glGenProgramPipelines", (void*)mock_glGenProgramPipelines },
+    { "glGenQueries", (void*)mock_glGenQueries },
+    { "glGenRenderbuffers", (void*)mock_glGenRenderbuffers },
+    { "glGenSamplers", (void*)mock_glGenSamplers },
+    { "glGenTextures", (void*)mock_glGenTextures },
+    { "glGenTransformFeedbacks", (void*)mock_glGenTransformFeedbacks },
+    { "glGenVertexArrays", (void*)mock_glGenVertexArrays },
+    { "glGetActiveAttrib", (void*)mock_glGetActiveAttrib },
+    { "glGetActiveUniform", (void*)mock_glGetActiveUniform },
+    { "glGetActiveUniformBlockName", (void*)mock_glGetActiveUniformBlockName },
+    { "glGetActiveUniformBlockiv", (void*)mock_glGetActiveUniformBlockiv },
+    { "glGetActiveUniformName", (void*)mock_glGetActiveUniformName },
+    { "glGetActiveUniformsiv", (void*)mock_glGetActiveUniformsiv },
+    { "glGetAttribLocation", (void*)mock_glGetAttribLocation },
+    { "glGetBooleani_v", (void*)mock_glGetBooleani_v },
+    { "glGetBooleanv", (void*)mock_glGetBooleanv },
+    { "glGetBufferParameteri64v", (void*)mock_glGetBufferParameteri64v },
+    { "glGetBufferParameteriv", (void*)mock_glGetBufferParameteriv },
+    { "glGetDoublei_v", (void*)mock_glGetDoublei_v },
+    { "glGetDoublev", (void*)mock_glGetDoublev },
+    { "glGetFloati_v", (void*)mock_glGetFloati_v },
+    { "glGetFloatv", (void*)mock_glGetFloatv },
+    { "glGetFramebufferAttachmentParameteriv", (void*)mock_glGetFramebufferAttachmentParameteriv },
+    { "glGetInteger64i_v", (void*)mock_glGetInteger64i_v },
+    { "glGetInteger64v", (void*)mock_glGetInteger64v },
+    { "glGetIntegeri_v", (void*)mock_glGetIntegeri_v },
+    { "glGetIntegerv", (void*)mock_glGetIntegerv },
+    { "glGetInternalformativ", (void*)mock_glGetInternalformativ },
+    { "glGetProgramBinary", (void*)mock_glGetProgramBinary },
+    { "glGetProgramInfoLog", (void*)mock_glGetProgramInfoLog },
+    { "glGetProgramPipelineInfoLog", (void*)mock_glGetProgramPipelineInfoLog },
+    { "glGetProgramPipelineiv", (void*)mock_glGetProgramPipelineiv },
+    { "glGetProgramiv", (void*)mock_glGetProgramiv },
+    { "glGetQueryObjecti64v", (void*)mock_glGetQueryObjecti64v },
+    { "glGetQueryObjectiv", (void*)mock_glGetQueryObjectiv },
+    { "glGetQueryObjectui64v", (void*)mock_glGetQueryObjectui64v },
+    { "glGetQueryObjectuiv", (void*)mock_glGetQueryObjectuiv },
+    { "glGetQueryiv", (void*)mock_glGetQueryiv },
+    { "glGetRenderbufferParameteriv", (void*)mock_glGetRenderbufferParameteriv },
+    { "glGetSamplerParameterfv", (void*)mock_glGetSamplerParameterfv },
+    { "glGetSamplerParameteriv", (void*)mock_glGetSamplerParameteriv },
+    { "glGetShaderInfoLog", (void*)mock_glGetShaderInfoLog },
+    { "glGetShaderPrecisionFormat", (void*)mock_glGetShaderPrecisionFormat },
+    { "glGetShaderSource", (void*)mock_glGetShaderSource },
+    { "glGetShaderiv", (void*)mock_glGetShaderiv },
+    { "glGetString", (void*)mock_glGetString },
+    { "glGetStringi", (void*)mock_glGetStringi },
+    { "glGetSynciv", (void*)mock_glGetSynciv },
+    { "glGetTexLevelParameterfv", (void*)mock_glGetTexLevelParameterfv },
+    { "glGetTexLevelParameteriv", (void*)mock_glGetTexLevelParameteriv },
+    { "glGetTexParameterfv", (void*)mock_glGetTexParameterfv },
+    { "glGetTexParameteriv", (void*)mock_glGetTexParameteriv },
+    { "glGetUniformIndices", (void*)mock_glGetUniformIndices },
+    { "glGetUniformLocation", (void*)mock_glGetUniformLocation },
+    { "glGetUniformdv", (void*)mock_glGetUniformdv },
+    { "glGetUniformfv", (void*)mock_glGetUniformfv },
+    { "glGetUniformiv", (void*)mock_glGetUniformiv },
+    { "glGetUniformuiv", (void*)mock_glGetUniformuiv },
+    { "glGetVertexAttribfv", (void*)mock_glGetVertexAttribfv },
+    { "glGetVertexAttribiv", (void*)mock_glGetVertexAttribiv },
+    { "glMapBuffer", (void*)mock_glMapBuffer },
+    { "glMapBufferRange", (void*)mock_glMapBufferRange },
+    { "glMapNamedBuffer", (void*)mock_glMapNamedBuffer },
+    { "glMapNamedBufferRange", (void*)mock_glMapNamedBufferRange },
+    { "glNamedBufferData", (void*)mock_glNamedBufferData },
+    { "glNamedBufferStorage", (void*)mock_glNamedBufferStorage },
+    { "glNamedBufferSubData", (void*)mock_glNamedBufferSubData },
+    { "glTexImage2D", (void*)mock_glTexImage2D },
+    { "glTexImage3D", (void*)mock_glTexImage3D },
+    { "glTexSubImage2D", (void*)mock_glTexSubImage2D },
+    { "glTexSubImage3D", (void*)mock_glTexSubImage3D },
+    { "glUnmapBuffer", (void*)mock_glUnmapBuffer },
+    { "glUnmapNamedBuffer", (void*)mock_glUnmapNamedBuffer }
+};
+
+/* Indexed by enum glad_mock_func, so sorted like glad_funcs.h. */
+static const struct glad_mock_entry mock_entries[] = {
+#define GLAD_FUNC(ret, name, pfn, params, args) { #name, (void*)glad_mock_##name },
+#define GLAD_FUNC_VOID(name, pfn, params, args) { #name, (void*)glad_mock_##name },
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+};
+
+static int compare_entry(const void *key, const void *entry) {
+    return strcmp((const char *)key, ((const struct glad_mock_entry *)entry)->name);
+}
+
+static const struct glad_mock_entry* find_entry(const struct glad_mock_entry *entries, size_t count, const char *name) {
+    return (const struct glad_mock_entry *)bsearch(name, entries, count, sizeof(entries[0]), compare_entry);
+}
+
+void* gladMockGetProcAddress(const char *name) {
+    const struct glad_mock_entry *entry;
+    if(name == NULL) return NULL;
+
+    entry = find_entry(mock_overrides, sizeof(mock_overrides) / sizeof(mock_overrides[0]), name);
+    if(entry == NULL) {
+        entry = find_entry(mock_entries, MOCK_FUNC_COUNT, name);
+    }
+    return entry != NULL ? entry->proc : NULL;
+}
+
+void gladMockSetExtensions(const char *const *names, int count) {
+    mock_exts = names;
+    mock_num_exts = names != NULL && count > 0 ? count : 0;
+}
+
+void gladMockReset(void) {
+    memset(mock_calls, 0, sizeof(mock_calls));
+    mock_objects_created = 0;
+    mock_buffer_alloc_bytes = 0;
+    mock_buffer_upload_bytes = 0;
+    mock_texture_upload_bytes = 0;
+}
+
+void gladMockGetStats(struct gladMockStats *stats) {
+    size_t index;
+    if(stats == NULL) return;
+
+    memset(stats, 0, sizeof(*stats));
+    for(index = 0; index < MOCK_FUNC_COUNT; index++) {
+        const char *name = mock_entries[index].name;
+        stats->calls += mock_calls[index];
+        /* glDrawBuffer(s) selects render targets and is not a draw. */
+        if((strncmp(name, "glDraw", 6) == 0 && strncmp(name, "glDrawBuffer", 12) != 0) ||
+            strncmp(name, "glMultiDraw", 11) == 0) {
+            stats->draw_calls += mock_calls[index];
+        }
+    }
+    stats->objects_created = mock_objects_created;
+    stats->buffer_alloc_bytes = mock_buffer_alloc_bytes;
+    stats->buffer_upload_bytes = mock_buffer_upload_bytes;
+    stats->texture_upload_bytes = mock_texture_upload_bytes;
+}
+
+unsigned long gladMockGetCallCount(const char *name) {
+    const struct glad_mock_entry *entry;
+    if(name == NULL) return 0;
+
+    entry = find_entry(mock_entries, MOCK_FUNC_COUNT, name);
+    return entry != NULL ? mock_calls[entry - mock_entries] : 0;
+}
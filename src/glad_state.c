@@ -0,0 +1,704 @@
+/*
+
+    GL state caching for glad, see glad/glad_state.h.
+
+    Bindings are tracked per target (and per texture unit), uniform values
+    per program and location in a small open-addressed table. Anything the
+    cache cannot follow exactly is forgotten rather than guessed, so a
+    forgotten entry only costs a redundant call.
+
+    Every glUniform* and glProgramUniform* entry point is wrapped: the
+    common forms below are cached, all others forget the locations they
+    write before reaching the driver.
+
+*/
+
+#include <string.h>
+#include <glad/glad.h>
+#include <glad/glad_state.h>
+
+#define STATE_TEXTURE_UNITS 32
+#define STATE_UNIFORM_SLOTS 1024
+#define STATE_UNIFORM_VALUES 16
+#define STATE_UNIFORM_PROBES 8
+/* Forgotten entries still occupy their slots; past this many the table is
+ * rebuilt without them. */
+#define STATE_UNIFORM_MAX_FORGOTTEN (STATE_UNIFORM_SLOTS / 4)
+
+struct glad_state_binding {
+    GLuint name;
+    int known;
+};
+
+static const GLenum state_buffer_targets[] = {
+    GL_ARRAY_BUFFER,
+    GL_ELEMENT_ARRAY_BUFFER,
+    GL_UNIFORM_BUFFER,
+    GL_COPY_READ_BUFFER,
+    GL_COPY_WRITE_BUFFER,
+    GL_PIXEL_PACK_BUFFER,
+    GL_PIXEL_UNPACK_BUFFER,
+    GL_TEXTURE_BUFFER,
+    GL_TRANSFORM_FEEDBACK_BUFFER,
+    GL_DRAW_INDIRECT_BUFFER
+};
+#define STATE_BUFFER_TARGETS (sizeof(state_buffer_targets) / sizeof(state_buffer_targets[0]))
+
+static const GLenum state_texture_targets[] = {
+    GL_TEXTURE_2D,
+    GL_TEXTURE_2D_ARRAY,
+    GL_TEXTURE_3D,
+    GL_TEXTURE_CUBE_MAP
+};
+#define STATE_TEXTURE_TARGETS (sizeof(state_texture_targets) / sizeof(state_texture_targets[0]))
+
+enum glad_state_uniform_kind {
+    UNIFORM_EMPTY = 0,
+    UNIFORM_FORGOTTEN, /* keeps program and location so probing continues past it */
+    UNIFORM_1I,
+    UNIFORM_1F,
+    UNIFORM_2F,
+    UNIFORM_3F,
+    UNIFORM_4F,
+    UNIFORM_MATRIX3,
+    UNIFORM_MATRIX3_TRANSPOSE,
+    UNIFORM_MATRIX4,
+    UNIFORM_MATRIX4_TRANSPOSE
+};
+
+struct glad_state_uniform {
+    GLuint program;
+    GLint location;
+    unsigned char kind;
+    unsigned char size; /* number of 4-byte values */
+    union {
+        GLint i[STATE_UNIFORM_VALUES];
+        GLfloat f[STATE_UNIFORM_VALUES];
+    } value;
+};
+
+static int state_installed = 0;
+static struct gladStateCacheStats state_stats;
+
+static struct glad_state_binding state_program;
+static struct glad_state_binding state_vertex_array;
+static struct glad_state_binding state_buffers[STATE_BUFFER_TARGETS];
+static struct glad_state_binding state_active_unit;
+static struct glad_state_binding state_textures[STATE_TEXTURE_UNITS][STATE_TEXTURE_TARGETS];
+static struct glad_state_uniform state_uniforms[STATE_UNIFORM_SLOTS];
+static struct glad_state_uniform state_uniforms_rehash[STATE_UNIFORM_SLOTS];
+static size_t state_uniforms_forgotten = 0;
+
+#define STATE_WRAPPED(X) \
+    X(glUseProgram, PFNGLUSEPROGRAMPROC) \
+    X(glLinkProgram, PFNGLLINKPROGRAMPROC) \
+    X(glProgramBinary, PFNGLPROGRAMBINARYPROC) \
+    X(glDeleteProgram, PFNGLDELETEPROGRAMPROC) \
+    X(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC) \
+    X(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC) \
+    X(glBindBuffer, PFNGLBINDBUFFERPROC) \
+    X(glBindBufferBase, PFNGLBINDBUFFERBASEPROC) \
+    X(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC) \
+    X(glBindBuffersBase, PFNGLBINDBUFFERSBASEPROC) \
+    X(glBindBuffersRange, PFNGLBINDBUFFERSRANGEPROC) \
+    X(glDeleteBuffers, PFNGLDELETEBUFFERSPROC) \
+    X(glActiveTexture, PFNGLACTIVETEXTUREPROC) \
+    X(glBindTexture, PFNGLBINDTEXTUREPROC) \
+    X(glBindTextures, PFNGLBINDTEXTURESPROC) \
+    X(glBindTextureUnit, PFNGLBINDTEXTUREUNITPROC) \
+    X(glDeleteTextures, PFNGLDELETETEXTURESPROC) \
+    X(glUseProgramObjectARB, PFNGLUSEPROGRAMOBJECTARBPROC) \
+    X(glActiveProgramEXT, PFNGLACTIVEPROGRAMEXTPROC) \
+    X(glUseShaderProgramEXT, PFNGLUSESHADERPROGRAMEXTPROC) \
+    X(glLinkProgramARB, PFNGLLINKPROGRAMARBPROC) \
+    X(glDeleteObjectARB, PFNGLDELETEOBJECTARBPROC) \
+    X(glBindVertexArrayAPPLE, PFNGLBINDVERTEXARRAYAPPLEPROC) \
+    X(glDeleteVertexArraysAPPLE, PFNGLDELETEVERTEXARRAYSAPPLEPROC) \
+    X(glVertexArrayElementBuffer, PFNGLVERTEXARRAYELEMENTBUFFERPROC) \
+    X(glBindBufferARB, PFNGLBINDBUFFERARBPROC) \
+    X(glBindBufferBaseEXT, PFNGLBINDBUFFERBASEEXTPROC) \
+    X(glBindBufferBaseNV, PFNGLBINDBUFFERBASENVPROC) \
+    X(glBindBufferRangeEXT, PFNGLBINDBUFFERRANGEEXTPROC) \
+    X(glBindBufferRangeNV, PFNGLBINDBUFFERRANGENVPROC) \
+    X(glBindBufferOffsetEXT, PFNGLBINDBUFFEROFFSETEXTPROC) \
+    X(glBindBufferOffsetNV, PFNGLBINDBUFFEROFFSETNVPROC) \
+    X(glDeleteBuffersARB, PFNGLDELETEBUFFERSARBPROC) \
+    X(glActiveTextureARB, PFNGLACTIVETEXTUREARBPROC) \
+    X(glBindTextureEXT, PFNGLBINDTEXTUREEXTPROC) \
+    X(glBindMultiTextureEXT, PFNGLBINDMULTITEXTUREEXTPROC) \
+    X(glDeleteTexturesEXT, PFNGLDELETETEXTURESEXTPROC) \
+    X(glPushClientAttribDefaultEXT, PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)
+
+/* Uniform entry points with a caching wrapper, installed over the generic
+ * forgetting wrappers built from glad_uniform_funcs.h. */
+#define STATE_UNIFORM_OVERRIDES(X) \
+    X(glUniform1i) \
+    X(glUniform1f) \
+    X(glUniform2f) \
+    X(glUniform3f) \
+    X(glUniform4f) \
+    X(glUniform2fv) \
+    X(glUniform3fv) \
+    X(glUniform4fv) \
+    X(glUniformMatrix3fv) \
+    X(glUniformMatrix4fv)
+
+#define STATE_REAL(name, pfn) static pfn real_##name = NULL;
+STATE_WRAPPED(STATE_REAL)
+#undef STATE_REAL
+
+static int elide(unsigned long *counter) {
+    (*counter)++;
+    state_stats.elided++;
+    return 1;
+}
+
+static int forward(void) {
+    state_stats.forwarded++;
+    return 0;
+}
+
+/* Returns 1 if binding already holds name, otherwise records it. */
+static int same_binding(struct glad_state_binding *binding, GLuint name) {
+    if(binding->known && binding->name == name) {
+        return 1;
+    }
+    binding->name = name;
+    binding->known = 1;
+    return 0;
+}
+
+static void forget_bindings(struct glad_state_binding *bindings, size_t count) {
+    memset(bindings, 0, count * sizeof(*bindings));
+}
+
+static void unbind_deleted(struct glad_state_binding *bindings, size_t count, GLsizei n, const GLuint *names) {
+    size_t index;
+    GLsizei deleted;
+    if(names == NULL) return;
+
+    for(index = 0; index < count; index++) {
+        for(deleted = 0; deleted < n; deleted++) {
+            if(bindings[index].known && names[deleted] != 0 && bindings[index].name == names[deleted]) {
+                bindings[index].name = 0;
+            }
+        }
+    }
+}
+
+static struct glad_state_binding* buffer_binding(GLenum target) {
+    size_t index;
+    for(index = 0; index < STATE_BUFFER_TARGETS; index++) {
+        if(state_buffer_targets[index] == target) return &state_buffers[index];
+    }
+    return NULL;
+}
+
+static void forget_buffer(GLenum target) {
+    struct glad_state_binding *binding = buffer_binding(target);
+    if(binding != NULL) forget_bindings(binding, 1);
+}
+
+static struct glad_state_binding* texture_binding(GLenum target) {
+    size_t index;
+    if(!state_active_unit.known || state_active_unit.name >= STATE_TEXTURE_UNITS) return NULL;
+    for(index = 0; index < STATE_TEXTURE_TARGETS; index++) {
+        if(state_texture_targets[index] == target) return &state_textures[state_active_unit.name][index];
+    }
+    return NULL;
+}
+
+static size_t uniform_slot(GLuint program, GLint location) {
+    return ((size_t)program * 2654435761UL ^ (size_t)location) & (STATE_UNIFORM_SLOTS - 1);
+}
+
+static void clear_uniforms(void) {
+    memset(state_uniforms, 0, sizeof(state_uniforms));
+    state_uniforms_forgotten = 0;
+}
+
+/* Rebuilds the table from its live entries, dropping forgotten ones and
+ * those of program (0 drops none). An entry that no longer fits within its
+ * probe window is dropped too, which only costs a redundant call. */
+static void rehash_uniforms(GLuint program) {
+    size_t index;
+    size_t slot;
+    size_t probes;
+
+    memcpy(state_uniforms_rehash, state_uniforms, sizeof(state_uniforms));
+    clear_uniforms();
+    for(index = 0; index < STATE_UNIFORM_SLOTS; index++) {
+        const struct glad_state_uniform *entry = &state_uniforms_rehash[index];
+        if(entry->kind == UNIFORM_EMPTY || entry->kind == UNIFORM_FORGOTTEN) continue;
+        if(program != 0 && entry->program == program) continue;
+
+        slot = uniform_slot(entry->program, entry->location);
+        for(probes = 0; probes < STATE_UNIFORM_PROBES; probes++) {
+            struct glad_state_uniform *target = &state_uniforms[(slot + probes) & (STATE_UNIFORM_SLOTS - 1)];
+            if(target->kind == UNIFORM_EMPTY) {
+                *target = *entry;
+                break;
+            }
+        }
+    }
+}
+
+static void forget_entry(struct glad_state_uniform *entry) {
+    if(entry->kind == UNIFORM_EMPTY || entry->kind == UNIFORM_FORGOTTEN) return;
+    entry->kind = UNIFORM_FORGOTTEN;
+    state_uniforms_forgotten++;
+}
+
+static void forget_uniforms(GLuint program) {
+    size_t index;
+    for(index = 0; index < STATE_UNIFORM_SLOTS; index++) {
+        if(state_uniforms[index].program == program) {
+            forget_entry(&state_uniforms[index]);
+        }
+    }
+    if(state_uniforms_forgotten > STATE_UNIFORM_MAX_FORGOTTEN) rehash_uniforms(0);
+}
+
+/* Forgets what a write of count values at location leaves behind. Array
+ * writes can reach the following locations, so they drop the whole program. */
+static void forget_uniform(GLuint program, GLint location, GLsizei count) {
+    struct glad_state_uniform *entry;
+    size_t slot;
+    size_t probes;
+
+    if(count != 1) {
+        forget_uniforms(program);
+        return;
+    }
+
+    slot = uniform_slot(program, location);
+    for(probes = 0; probes < STATE_UNIFORM_PROBES; probes++) {
+        entry = &state_uniforms[(slot + probes) & (STATE_UNIFORM_SLOTS - 1)];
+        if(entry->kind == UNIFORM_EMPTY) {
+            return;
+        }
+        if(entry->program == program && entry->location == location) {
+            forget_entry(entry);
+            break;
+        }
+    }
+    if(state_uniforms_forgotten > STATE_UNIFORM_MAX_FORGOTTEN) rehash_uniforms(0);
+}
+
+/* glUniform* writes to the current program; if that is not known, any
+ * program may be affected. */
+static void forget_current_uniform(GLint location, GLsizei count) {
+    if(state_program.known) {
+        forget_uniform(state_program.name, location, count);
+    } else {
+        clear_uniforms();
+    }
+}
+
+/* Returns 1 if the current program's uniform at location already holds the
+ * given value, otherwise records it. Values that cannot be cached (unknown
+ * program, too large, table full) always report a change. */
+static int same_uniform(GLint location, unsigned char kind, const void *value, size_t size) {
+    struct glad_state_uniform *entry;
+    struct glad_state_uniform *reuse = NULL;
+    size_t slot;
+    size_t probes;
+
+    if(!state_program.known || state_program.name == 0 || size > STATE_UNIFORM_VALUES) {
+        return 0;
+    }
+
+    /* A key only ever lives within its probe window, so once the window
+     * holds no match the first forgotten slot in it can take the value. */
+    slot = uniform_slot(state_program.name, location);
+    for(probes = 0; probes < STATE_UNIFORM_PROBES; probes++) {
+        entry = &state_uniforms[(slot + probes) & (STATE_UNIFORM_SLOTS - 1)];
+        if(entry->kind == UNIFORM_EMPTY) {
+            if(reuse != NULL) entry = reuse;
+            break;
+        }
+        if(entry->program == state_program.name && entry->location == location) {
+            if(entry->kind == kind && entry->size == size &&
+                memcmp(entry->value.i, value, size * 4) == 0) {
+                return 1;
+            }
+            break;
+        }
+        if(entry->kind == UNIFORM_FORGOTTEN && reuse == NULL) {
+            reuse = entry;
+        }
+    }
+    if(probes == STATE_UNIFORM_PROBES) {
+        if(reuse == NULL) return 0;
+        entry = reuse;
+    }
+    if(entry->kind == UNIFORM_FORGOTTEN) {
+        state_uniforms_forgotten--;
+    }
+
+    entry->program = state_program.name;
+    entry->location = location;
+    entry->kind = kind;
+    entry->size = (unsigned char)size;
+    memcpy(entry->value.i, value, size * 4);
+    return 0;
+}
+
+static void APIENTRY state_glUseProgram(GLuint program) {
+    if(same_binding(&state_program, program) ? elide(&state_stats.program_elided) : forward()) return;
+    real_glUseProgram(program);
+}
+
+static void APIENTRY state_glLinkProgram(GLuint program) {
+    forget_uniforms(program);
+    real_glLinkProgram(program);
+}
+
+static void APIENTRY state_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    forget_uniforms(program);
+    real_glProgramBinary(program, binaryFormat, binary, length);
+}
+
+static void APIENTRY state_glDeleteProgram(GLuint program) {
+    rehash_uniforms(program);
+    real_glDeleteProgram(program);
+}
+
+static void APIENTRY state_glBindVertexArray(GLuint array) {
+    if(same_binding(&state_vertex_array, array) ? elide(&state_stats.vertex_array_elided) : forward()) return;
+    /* The element array binding is vertex array state. */
+    forget_buffer(GL_ELEMENT_ARRAY_BUFFER);
+    real_glBindVertexArray(array);
+}
+
+static void APIENTRY state_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    GLuint previous = state_vertex_array.name;
+    unbind_deleted(&state_vertex_array, 1, n, arrays);
+    if(state_vertex_array.known && state_vertex_array.name != previous) {
+        forget_buffer(GL_ELEMENT_ARRAY_BUFFER);
+    }
+    real_glDeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY state_glBindBuffer(GLenum target, GLuint buffer) {
+    struct glad_state_binding *binding = buffer_binding(target);
+    if(binding != NULL && (same_binding(binding, buffer) ? elide(&state_stats.buffer_elided) : forward())) return;
+    real_glBindBuffer(target, buffer);
+}
+
+static void APIENTRY state_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    forget_buffer(target);
+    real_glBindBufferBase(target, index, buffer);
+}
+
+static void APIENTRY state_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    forget_buffer(target);
+    real_glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void APIENTRY state_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+    forget_buffer(target);
+    real_glBindBuffersBase(target, first, count, buffers);
+}
+
+static void APIENTRY state_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+    forget_buffer(target);
+    real_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+
+static void APIENTRY state_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    unbind_deleted(state_buffers, STATE_BUFFER_TARGETS, n, buffers);
+    real_glDeleteBuffers(n, buffers);
+}
+
+static void APIENTRY state_glActiveTexture(GLenum texture) {
+    if(same_binding(&state_active_unit, texture - GL_TEXTURE0) ? elide(&state_stats.texture_elided) : forward()) return;
+    real_glActiveTexture(texture);
+}
+
+static void APIENTRY state_glBindTexture(GLenum target, GLuint texture) {
+    struct glad_state_binding *binding = texture_binding(target);
+    if(binding != NULL && (same_binding(binding, texture) ? elide(&state_stats.texture_elided) : forward())) return;
+    real_glBindTexture(target, texture);
+}
+
+static void APIENTRY state_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    forget_bindings(&state_textures[0][0], STATE_TEXTURE_UNITS * STATE_TEXTURE_TARGETS);
+    real_glBindTextures(first, count, textures);
+}
+
+static void APIENTRY state_glBindTextureUnit(GLuint unit, GLuint texture) {
+    forget_bindings(&state_textures[0][0], STATE_TEXTURE_UNITS * STATE_TEXTURE_TARGETS);
+    real_glBindTextureUnit(unit, texture);
+}
+
+static void APIENTRY state_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    unbind_deleted(&state_textures[0][0], STATE_TEXTURE_UNITS * STATE_TEXTURE_TARGETS, n, textures);
+    real_glDeleteTextures(n, textures);
+}
+
+/* Extension and direct state access forms of the calls above change the
+ * same state without being cached; they only forget what they touch. */
+static void APIENTRY state_glUseProgramObjectARB(GLhandleARB programObj) {
+    forget_bindings(&state_program, 1);
+    real_glUseProgramObjectARB(programObj);
+}
+
+static void APIENTRY state_glActiveProgramEXT(GLuint program) {
+    forget_bindings(&state_program, 1);
+    real_glActiveProgramEXT(program);
+}
+
+static void APIENTRY state_glUseShaderProgramEXT(GLenum type, GLuint program) {
+    forget_bindings(&state_program, 1);
+    real_glUseShaderProgramEXT(type, program);
+}
+
+/* A GLhandleARB is not necessarily a GLuint program name, so these forget
+ * every program's uniforms. */
+static void APIENTRY state_glLinkProgramARB(GLhandleARB programObj) {
+    clear_uniforms();
+    real_glLinkProgramARB(programObj);
+}
+
+static void APIENTRY state_glDeleteObjectARB(GLhandleARB obj) {
+    clear_uniforms();
+    real_glDeleteObjectARB(obj);
+}
+
+static void APIENTRY state_glBindVertexArrayAPPLE(GLuint array) {
+    forget_bindings(&state_vertex_array, 1);
+    forget_buffer(GL_ELEMENT_ARRAY_BUFFER);
+    real_glBindVertexArrayAPPLE(array);
+}
+
+static void APIENTRY state_glDeleteVertexArraysAPPLE(GLsizei n, const GLuint *arrays) {
+    forget_bindings(&state_vertex_array, 1);
+    forget_buffer(GL_ELEMENT_ARRAY_BUFFER);
+    real_glDeleteVertexArraysAPPLE(n, arrays);
+}
+
+static void APIENTRY state_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+    forget_buffer(GL_ELEMENT_ARRAY_BUFFER);
+    real_glVertexArrayElementBuffer(vaobj, buffer);
+}
+
+static void APIENTRY state_glBindBufferARB(GLenum target, GLuint buffer) {
+    forget_buffer(target);
+    real_glBindBufferARB(target, buffer);
+}
+
+static void APIENTRY state_glBindBufferBaseEXT(GLenum target, GLuint index, GLuint buffer) {
+    forget_buffer(target);
+    real_glBindBufferBaseEXT(target, index, buffer);
+}
+
+static void APIENTRY state_glBindBufferBaseNV(GLenum target, GLuint index, GLuint buffer) {
+    forget_buffer(target);
+    real_glBindBufferBaseNV(target, index, buffer);
+}
+
+static void APIENTRY state_glBindBufferRangeEXT(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    forget_buffer(target);
+    real_glBindBufferRangeEXT(target, index, buffer, offset, size);
+}
+
+static void APIENTRY state_glBindBufferRangeNV(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    forget_buffer(target);
+    real_glBindBufferRangeNV(target, index, buffer, offset, size);
+}
+
+static void APIENTRY state_glBindBufferOffsetEXT(GLenum target, GLuint index, GLuint buffer, GLintptr offset) {
+    forget_buffer(target);
+    real_glBindBufferOffsetEXT(target, index, buffer, offset);
+}
+
+static void APIENTRY state_glBindBufferOffsetNV(GLenum target, GLuint index, GLuint buffer, GLintptr offset) {
+    forget_buffer(target);
+    real_glBindBufferOffsetNV(target, index, buffer, offset);
+}
+
+static void APIENTRY state_glDeleteBuffersARB(GLsizei n, const GLuint *buffers) {
+    unbind_deleted(state_buffers, STATE_BUFFER_TARGETS, n, buffers);
+    real_glDeleteBuffersARB(n, buffers);
+}
+
+static void APIENTRY state_glActiveTextureARB(GLenum texture) {
+    forget_bindings(&state_active_unit, 1);
+    real_glActiveTextureARB(texture);
+}
+
+static void APIENTRY state_glBindTextureEXT(GLenum target, GLuint texture) {
+    struct glad_state_binding *binding = texture_binding(target);
+    if(binding != NULL) forget_bindings(binding, 1);
+    real_glBindTextureEXT(target, texture);
+}
+
+static void APIENTRY state_glBindMultiTextureEXT(GLenum texunit, GLenum target, GLuint texture) {
+    forget_bindings(&state_textures[0][0], STATE_TEXTURE_UNITS * STATE_TEXTURE_TARGETS);
+    real_glBindMultiTextureEXT(texunit, target, texture);
+}
+
+static void APIENTRY state_glDeleteTexturesEXT(GLsizei n, const GLuint *textures) {
+    unbind_deleted(&state_textures[0][0], STATE_TEXTURE_UNITS * STATE_TEXTURE_TARGETS, n, textures);
+    real_glDeleteTexturesEXT(n, textures);
+}
+
+/* Resets client state, which includes buffer bindings, to the defaults. */
+static void APIENTRY state_glPushClientAttribDefaultEXT(GLbitfield mask) {
+    forget_bindings(state_buffers, STATE_BUFFER_TARGETS);
+    real_glPushClientAttribDefaultEXT(mask);
+}
+
+#define GLAD_UNIFORM(name, pfn, params, args, location, count) \
+    static pfn state_real_##name = NULL; \
+    static void APIENTRY glad_state_##name params { \
+        forget_current_uniform(location, count); \
+        state_real_##name args; \
+    }
+#define GLAD_PROGRAM_UNIFORM(name, pfn, params, args, program, location, count) \
+    static pfn state_real_##name = NULL; \
+    static void APIENTRY glad_state_##name params { \
+        forget_uniform(program, location, count); \
+        state_real_##name args; \
+    }
+#include "glad_uniform_funcs.h"
+#undef GLAD_UNIFORM
+#undef GLAD_PROGRAM_UNIFORM
+
+static void APIENTRY state_glUniform1i(GLint location, GLint v0) {
+    if(same_uniform(location, UNIFORM_1I, &v0, 1) ? elide(&state_stats.uniform_elided) : forward()) return;
+    state_real_glUniform1i(location, v0);
+}
+
+static void APIENTRY state_glUniform1f(GLint location, GLfloat v0) {
+    if(same_uniform(location, UNIFORM_1F, &v0, 1) ? elide(&state_stats.uniform_elided) : forward()) return;
+    state_real_glUniform1f(location, v0);
+}
+
+static void APIENTRY state_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    GLfloat value[2];
+    value[0] = v0; value[1] = v1;
+    if(same_uniform(location, UNIFORM_2F, value, 2) ? elide(&state_stats.uniform_elided) : forward()) return;
+    state_real_glUniform2f(location, v0, v1);
+}
+
+static void APIENTRY state_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    GLfloat value[3];
+    value[0] = v0; value[1] = v1; value[2] = v2;
+    if(same_uniform(location, UNIFORM_3F, value, 3) ? elide(&state_stats.uniform_elided) : forward()) return;
+    state_real_glUniform3f(location, v0, v1, v2);
+}
+
+static void APIENTRY state_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    GLfloat value[4];
+    value[0] = v0; value[1] = v1; value[2] = v2; value[3] = v3;
+    if(same_uniform(location, UNIFORM_4F, value, 4) ? elide(&state_stats.uniform_elided) : forward()) return;
+    state_real_glUniform4f(location, v0, v1, v2, v3);
+}
+
+/* The vector forms share kinds with the scalar forms: glUniform3f(l, x, y, z)
+ * and glUniform3fv(l, 1, xyz) set the same value. */
+static void APIENTRY state_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    if(count == 1 && (same_uniform(location, UNIFORM_2F, value, 2) ? elide(&state_stats.uniform_elided) : forward())) return;
+    if(count != 1) forget_current_uniform(location, count);
+    state_real_glUniform2fv(location, count, value);
+}
+
+static void APIENTRY state_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    if(count == 1 && (same_uniform(location, UNIFORM_3F, value, 3) ? elide(&state_stats.uniform_elided) : forward())) return;
+    if(count != 1) forget_current_uniform(location, count);
+    state_real_glUniform3fv(location, count, value);
+}
+
+static void APIENTRY state_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    if(count == 1 && (same_uniform(location, UNIFORM_4F, value, 4) ? elide(&state_stats.uniform_elided) : forward())) return;
+    if(count != 1) forget_current_uniform(location, count);
+    state_real_glUniform4fv(location, count, value);
+}
+
+static void APIENTRY state_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned char kind = transpose ? UNIFORM_MATRIX3_TRANSPOSE : UNIFORM_MATRIX3;
+    if(count == 1 && (same_uniform(location, kind, value, 9) ? elide(&state_stats.uniform_elided) : forward())) return;
+    if(count != 1) forget_current_uniform(location, count);
+    state_real_glUniformMatrix3fv(location, count, transpose, value);
+}
+
+static void APIENTRY state_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    unsigned char kind = transpose ? UNIFORM_MATRIX4_TRANSPOSE : UNIFORM_MATRIX4;
+    if(count == 1 && (same_uniform(location, kind, value, 16) ? elide(&state_stats.uniform_elided) : forward())) return;
+    if(count != 1) forget_current_uniform(location, count);
+    state_real_glUniformMatrix4fv(location, count, transpose, value);
+}
+
+int gladStateCacheInstall(void) {
+    if(state_installed) return 0;
+
+    gladStateCacheInvalidate();
+
+#define STATE_INSTALL(name, pfn) \
+    real_##name = glad_##name; \
+    if(glad_##name != NULL) glad_##name = state_##name;
+    STATE_WRAPPED(STATE_INSTALL)
+#undef STATE_INSTALL
+
+#define GLAD_UNIFORM(name, pfn, params, args, location, count) \
+    state_real_##name = glad_##name; \
+    if(glad_##name != NULL) glad_##name = glad_state_##name;
+#define GLAD_PROGRAM_UNIFORM(name, pfn, params, args, program, location, count) \
+    state_real_##name = glad_##name; \
+    if(glad_##name != NULL) glad_##name = glad_state_##name;
+#include "glad_uniform_funcs.h"
+#undef GLAD_UNIFORM
+#undef GLAD_PROGRAM_UNIFORM
+
+#define STATE_INSTALL_OVERRIDE(name) \
+    if(glad_##name != NULL) glad_##name = state_##name;
+    STATE_UNIFORM_OVERRIDES(STATE_INSTALL_OVERRIDE)
+#undef STATE_INSTALL_OVERRIDE
+
+    state_installed = 1;
+    return 1;
+}
+
+void gladStateCacheUninstall(void) {
+    if(!state_installed) return;
+
+#define STATE_UNINSTALL(name, pfn) \
+    if(glad_##name == state_##name) glad_##name = real_##name;
+    STATE_WRAPPED(STATE_UNINSTALL)
+#undef STATE_UNINSTALL
+
+#define STATE_UNINSTALL_OVERRIDE(name) \
+    if(glad_##name == state_##name) glad_##name = glad_state_##name;
+    STATE_UNIFORM_OVERRIDES(STATE_UNINSTALL_OVERRIDE)
+#undef STATE_UNINSTALL_OVERRIDE
+
+#define GLAD_UNIFORM(name, pfn, params, args, location, count) \
+    if(glad_##name == glad_state_##name) glad_##name = state_real_##name;
+#define GLAD_PROGRAM_UNIFORM(name, pfn, params, args, program, location, count) \
+    if(glad_##name == glad_state_##name) glad_##name = state_real_##name;
+#include "glad_uniform_funcs.h"
+#undef GLAD_UNIFORM
+#undef GLAD_PROGRAM_UNIFORM
+
+    state_installed = 0;
+}
+
+void gladStateCacheInvalidate(void) {
+    forget_bindings(&state_program, 1);
+    forget_bindings(&state_vertex_array, 1);
+    forget_bindings(state_buffers, STATE_BUFFER_TARGETS);
+    forget_bindings(&state_active_unit, 1);
+    forget_bindings(&state_textures[0][0], STATE_TEXTURE_UNITS * STATE_TEXTURE_TARGETS);
+    clear_uniforms();
+}
+
+void gladStateCacheGetStats(struct gladStateCacheStats *stats) {
+    if(stats == NULL) return;
+    *stats = state_stats;
+}
+
+void gladStateCacheResetStats(void) {
+    memset(&state_stats, 0, sizeof(state_stats));
+}
@@ -0,0 +1,299 @@
+/*
+
+    Per-frame GL call tracing for glad, see glad/glad_trace.h.
+
+    Every entry point in glad_funcs.h gets a shim that bumps its counter and
+    forwards to the pointer that was loaded before installation. Upload
+    entry points additionally account the bytes passed to the driver.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad.h>
+#include <glad/glad_trace.h>
+#include "glad_image.h"
+
+enum glad_trace_func {
+#define GLAD_FUNC(ret, name, pfn, params, args) TRACE_##name,
+#define GLAD_FUNC_VOID(name, pfn, params, args) TRACE_##name,
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+    TRACE_FUNC_COUNT
+};
+
+static const char *const trace_names[] = {
+#define GLAD_FUNC(ret, name, pfn, params, args) #name,
+#define GLAD_FUNC_VOID(name, pfn, params, args) #name,
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+};
+
+enum glad_trace_kind {
+    TRACE_KIND_OTHER,
+    TRACE_KIND_DRAW,
+    TRACE_KIND_STATE,
+    TRACE_KIND_UNIFORM
+};
+
+static int trace_installed = 0;
+static unsigned char trace_kinds[TRACE_FUNC_COUNT];
+
+static unsigned long trace_calls[TRACE_FUNC_COUNT];
+static GLuint64 trace_buffer_bytes = 0;
+static GLuint64 trace_texture_bytes = 0;
+
+static unsigned long trace_last_calls[TRACE_FUNC_COUNT];
+static GLuint64 trace_last_buffer_bytes = 0;
+static GLuint64 trace_last_texture_bytes = 0;
+static unsigned long trace_frame = 0;
+
+#define GLAD_FUNC(ret, name, pfn, params, args) \
+    static pfn trace_real_##name = NULL; \
+    static ret APIENTRY glad_trace_##name params { \
+        trace_calls[TRACE_##name]++; \
+        return trace_real_##name args; \
+    }
+#define GLAD_FUNC_VOID(name, pfn, params, args) \
+    static pfn trace_real_##name = NULL; \
+    static void APIENTRY glad_trace_##name params { \
+        trace_calls[TRACE_##name]++; \
+        trace_real_##name args; \
+    }
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+
+static void APIENTRY trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    if(data != NULL && size > 0) trace_buffer_bytes += (GLuint64)size;
+    glad_trace_glBufferData(target, size, data, usage);
+}
+
+static void APIENTRY trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    if(data != NULL && size > 0) trace_buffer_bytes += (GLuint64)size;
+    glad_trace_glBufferSubData(target, offset, size, data);
+}
+
+static void APIENTRY trace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    if(data != NULL && size > 0) trace_buffer_bytes += (GLuint64)size;
+    glad_trace_glBufferStorage(target, size, data, flags);
+}
+
+static void APIENTRY trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if(pixels != NULL) trace_texture_bytes += glad_image_size(width, height, 1, format, type);
+    glad_trace_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    if(pixels != NULL) trace_texture_bytes += glad_image_size(width, height, 1, format, type);
+    glad_trace_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if(pixels != NULL) trace_texture_bytes += glad_image_size(width, height, depth, format, type);
+    glad_trace_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    if(pixels != NULL) trace_texture_bytes += glad_image_size(width, height, depth, format, type);
+    glad_trace_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+#define TRACE_OVERRIDES(X) \
+    X(glBufferData) \
+    X(glBufferSubData) \
+    X(glBufferStorage) \
+    X(glTexImage2D) \
+    X(glTexSubImage2D) \
+    X(glTexImage3D) \
+    X(glTexSubImage3D)
+
+static int has_prefix(const char *name, const char *prefix) {
+    return strncmp(name, prefix, strlen(prefix)) == 0;
+}
+
+static unsigned char classify(const char *name) {
+    static const char *const state_prefixes[] = {
+        "glBind", "glUseProgram", "glActiveTexture", "glEnable", "glDisable",
+        "glBlend", "glDepthFunc", "glDepthMask", "glDepthRange", "glCullFace",
+        "glFrontFace", "glViewport", "glScissor", "glPolygonMode", "glPolygonOffset",
+        "glColorMask", "glStencil", "glPixelStore", "glClearColor", "glClearDepth",
+        "glLineWidth", "glPointSize", "glVertexAttribPointer", "glVertexAttribIPointer",
+        "glDrawBuffer",
+        NULL
+    };
+    int index;
+
+    /* glDrawBuffer(s) selects render targets and is state, not a draw. */
+    if((has_prefix(name, "glDraw") && !has_prefix(name, "glDrawBuffer")) || has_prefix(name, "glMultiDraw")) {
+        return TRACE_KIND_DRAW;
+    }
+    if(has_prefix(name, "glUniform") || has_prefix(name, "glProgramUniform")) {
+        return TRACE_KIND_UNIFORM;
+    }
+    for(index = 0; state_prefixes[index] != NULL; index++) {
+        if(has_prefix(name, state_prefixes[index])) {
+            return TRACE_KIND_STATE;
+        }
+    }
+    return TRACE_KIND_OTHER;
+}
+
+int gladTraceInstall(void) {
+    size_t index;
+    if(trace_installed) return 0;
+
+    for(index = 0; index < TRACE_FUNC_COUNT; index++) {
+        trace_kinds[index] = classify(trace_names[index]);
+    }
+
+#define GLAD_FUNC(ret, name, pfn, params, args) \
+    trace_real_##name = glad_##name; \
+    if(glad_##name != NULL) glad_##name = glad_trace_##name;
+#define GLAD_FUNC_VOID(name, pfn, params, args) \
+    trace_real_##name = glad_##name; \
+    if(glad_##name != NULL) glad_##name = glad_trace_##name;
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+
+#define TRACE_INSTALL_OVERRIDE(name) \
+    if(glad_##name != NULL) glad_##name = trace_##name;
+    TRACE_OVERRIDES(TRACE_INSTALL_OVERRIDE)
+#undef TRACE_INSTALL_OVERRIDE
+
+    memset(trace_calls, 0, sizeof(trace_calls));
+    trace_buffer_bytes = 0;
+    trace_texture_bytes = 0;
+    trace_installed = 1;
+    return 1;
+}
+
+void gladTraceUninstall(void) {
+    if(!trace_installed) return;
+
+#define TRACE_UNINSTALL_OVERRIDE(name) \
+    if(glad_##name == trace_##name) glad_##name = glad_trace_##name;
+    TRACE_OVERRIDES(TRACE_UNINSTALL_OVERRIDE)
+#undef TRACE_UNINSTALL_OVERRIDE
+
+#define GLAD_FUNC(ret, name, pfn, params, args) \
+    if(glad_##name == glad_trace_##name) glad_##name = trace_real_##name;
+#define GLAD_FUNC_VOID(name, pfn, params, args) \
+    if(glad_##name == glad_trace_##name) glad_##name = trace_real_##name;
+#include "glad_funcs.h"
+#undef GLAD_FUNC
+#undef GLAD_FUNC_VOID
+
+    trace_installed = 0;
+}
+
+void gladTraceEndFrame(void) {
+    memcpy(trace_last_calls, trace_calls, sizeof(trace_calls));
+    trace_last_buffer_bytes = trace_buffer_bytes;
+    trace_last_texture_bytes = trace_texture_bytes;
+    trace_frame++;
+
+    memset(trace_calls, 0, sizeof(trace_calls));
+    trace_buffer_bytes = 0;
+    trace_texture_bytes = 0;
+}
+
+void gladTraceGetFrameStats(struct gladTraceStats *stats) {
+    size_t index;
+    if(stats == NULL) return;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->frame = trace_frame;
+    for(index = 0; index < TRACE_FUNC_COUNT; index++) {
+        unsigned long count = trace_last_calls[index];
+        stats->calls += count;
+        switch(trace_kinds[index]) {
+            case TRACE_KIND_DRAW: stats->draw_calls += count; break;
+            case TRACE_KIND_STATE: stats->state_calls += count; break;
+            case TRACE_KIND_UNIFORM: stats->uniform_calls += count; break;
+            default: break;
+        }
+    }
+    stats->buffer_upload_bytes = trace_last_buffer_bytes;
+    stats->texture_upload_bytes = trace_last_texture_bytes;
+}
+
+static int compare_name(const void *key, const void *entry) {
+    return strcmp((const char *)key, *(const char *const *)entry);
+}
+
+unsigned long gladTraceGetCallCount(const char *name) {
+    const char *const *entry;
+    if(name == NULL) return 0;
+
+    entry = (const char *const *)bsearch(name, trace_names, TRACE_FUNC_COUNT,
+        sizeof(trace_names[0]), compare_name);
+    return entry != NULL ? trace_last_calls[entry - trace_names] : 0;
+}
+
+int gladTraceGetTopCalls(struct gladTraceCall *calls, int max) {
+    size_t index;
+    int used = 0;
+    if(calls == NULL || max <= 0) return 0;
+
+    /* Insertion into a short sorted list; max is a handful of rows. */
+    for(index = 0; index < TRACE_FUNC_COUNT; index++) {
+        unsigned long count = trace_last_calls[index];
+        int slot;
+        if(count == 0) continue;
+        if(used == max && calls[used - 1].count >= count) continue;
+
+        slot = used < max ? used++ : max - 1;
+        while(slot > 0 && calls[slot - 1].count < count) {
+            calls[slot] = calls[slot - 1];
+            slot--;
+        }
+        calls[slot].name = trace_names[index];
+        calls[slot].count = count;
+    }
+    return used;
+}
+
+static size_t append(char *buffer, size_t size, size_t length, const char *text) {
+    size_t text_length = strlen(text);
+    if(length + 1 >= size) return length;
+    if(text_length > size - length - 1) text_length = size - length - 1;
+    memcpy(buffer + length, text, text_length);
+    buffer[length + text_length] = '\0';
+    return length + text_length;
+}
+
+size_t gladTraceFormatFrame(char *buffer, size_t size, int top_calls) {
+    struct gladTraceStats stats;
+    struct gladTraceCall top[16];
+    char line[160];
+    size_t length = 0;
+    int count;
+    int index;
+
+    if(buffer == NULL || size == 0) return 0;
+    buffer[0] = '\0';
+
+    gladTraceGetFrameStats(&stats);
+    snprintf(line, sizeof line, "GL frame %lu: %lu calls, %lu draws, %lu state, %lu uniform\n",
+        stats.frame, stats.calls, stats.draw_calls, stats.state_calls, stats.uniform_calls);
+    length = append(buffer, size, length, line);
+    snprintf(line, sizeof line, "uploads: %lu KiB buffers, %lu KiB textures\n",
+        (unsigned long)(stats.buffer_upload_bytes / 1024),
+        (unsigned long)(stats.texture_upload_bytes / 1024));
+    length = append(buffer, size, length, line);
+
+    if(top_calls > (int)(sizeof(top) / sizeof(top[0]))) {
+        top_calls = (int)(sizeof(top) / sizeof(top[0]));
+    }
+    count = gladTraceGetTopCalls(top, top_calls);
+    for(index = 0; index < count; index++) {
+        snprintf(line, sizeof line, "  %-.100s %lu\n", top[index].name, top[index].count);
+        length = append(buffer, size, length, line);
+    }
+    return length;
+}
@@ -0,0 +1,266 @@
+/*
+
+    X-macro list of every entry point in glad/glad.h that writes uniforms.
+    Generated by tools/glad_funcs.py; do not edit by hand.
+
+    GLAD_UNIFORM(name, pfn, params, args, location, count)
+    GLAD_PROGRAM_UNIFORM(name, pfn, params, args, program, location, count)
+
+    Entries are sorted by name in strcmp() order.
+
+*/
+
+GLAD_PROGRAM_UNIFORM(glProgramUniform1d, PFNGLPROGRAMUNIFORM1DPROC, (GLuint program, GLint location, GLdouble v0), (program, location, v0), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1dEXT, PFNGLPROGRAMUNIFORM1DEXTPROC, (GLuint program, GLint location, GLdouble x), (program, location, x), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1dv, PFNGLPROGRAMUNIFORM1DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1dvEXT, PFNGLPROGRAMUNIFORM1DVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1f, PFNGLPROGRAMUNIFORM1FPROC, (GLuint program, GLint location, GLfloat v0), (program, location, v0), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1fEXT, PFNGLPROGRAMUNIFORM1FEXTPROC, (GLuint program, GLint location, GLfloat v0), (program, location, v0), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1fv, PFNGLPROGRAMUNIFORM1FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1fvEXT, PFNGLPROGRAMUNIFORM1FVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1i, PFNGLPROGRAMUNIFORM1IPROC, (GLuint program, GLint location, GLint v0), (program, location, v0), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1i64ARB, PFNGLPROGRAMUNIFORM1I64ARBPROC, (GLuint program, GLint location, GLint64 x), (program, location, x), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1i64NV, PFNGLPROGRAMUNIFORM1I64NVPROC, (GLuint program, GLint location, GLint64EXT x), (program, location, x), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1i64vARB, PFNGLPROGRAMUNIFORM1I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1i64vNV, PFNGLPROGRAMUNIFORM1I64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1iEXT, PFNGLPROGRAMUNIFORM1IEXTPROC, (GLuint program, GLint location, GLint v0), (program, location, v0), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1iv, PFNGLPROGRAMUNIFORM1IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1ivEXT, PFNGLPROGRAMUNIFORM1IVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1ui, PFNGLPROGRAMUNIFORM1UIPROC, (GLuint program, GLint location, GLuint v0), (program, location, v0), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1ui64ARB, PFNGLPROGRAMUNIFORM1UI64ARBPROC, (GLuint program, GLint location, GLuint64 x), (program, location, x), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1ui64NV, PFNGLPROGRAMUNIFORM1UI64NVPROC, (GLuint program, GLint location, GLuint64EXT x), (program, location, x), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1ui64vARB, PFNGLPROGRAMUNIFORM1UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1ui64vNV, PFNGLPROGRAMUNIFORM1UI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1uiEXT, PFNGLPROGRAMUNIFORM1UIEXTPROC, (GLuint program, GLint location, GLuint v0), (program, location, v0), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1uiv, PFNGLPROGRAMUNIFORM1UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform1uivEXT, PFNGLPROGRAMUNIFORM1UIVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2d, PFNGLPROGRAMUNIFORM2DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2dEXT, PFNGLPROGRAMUNIFORM2DEXTPROC, (GLuint program, GLint location, GLdouble x, GLdouble y), (program, location, x, y), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2dv, PFNGLPROGRAMUNIFORM2DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2dvEXT, PFNGLPROGRAMUNIFORM2DVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2f, PFNGLPROGRAMUNIFORM2FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2fEXT, PFNGLPROGRAMUNIFORM2FEXTPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2fv, PFNGLPROGRAMUNIFORM2FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2fvEXT, PFNGLPROGRAMUNIFORM2FVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2i, PFNGLPROGRAMUNIFORM2IPROC, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2i64ARB, PFNGLPROGRAMUNIFORM2I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y), (program, location, x, y), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2i64NV, PFNGLPROGRAMUNIFORM2I64NVPROC, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y), (program, location, x, y), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2i64vARB, PFNGLPROGRAMUNIFORM2I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2i64vNV, PFNGLPROGRAMUNIFORM2I64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2iEXT, PFNGLPROGRAMUNIFORM2IEXTPROC, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2iv, PFNGLPROGRAMUNIFORM2IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2ivEXT, PFNGLPROGRAMUNIFORM2IVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2ui, PFNGLPROGRAMUNIFORM2UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2ui64ARB, PFNGLPROGRAMUNIFORM2UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y), (program, location, x, y), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2ui64NV, PFNGLPROGRAMUNIFORM2UI64NVPROC, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y), (program, location, x, y), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2ui64vARB, PFNGLPROGRAMUNIFORM2UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2ui64vNV, PFNGLPROGRAMUNIFORM2UI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2uiEXT, PFNGLPROGRAMUNIFORM2UIEXTPROC, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2uiv, PFNGLPROGRAMUNIFORM2UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform2uivEXT, PFNGLPROGRAMUNIFORM2UIVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3d, PFNGLPROGRAMUNIFORM3DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3dEXT, PFNGLPROGRAMUNIFORM3DEXTPROC, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z), (program, location, x, y, z), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3dv, PFNGLPROGRAMUNIFORM3DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3dvEXT, PFNGLPROGRAMUNIFORM3DVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3f, PFNGLPROGRAMUNIFORM3FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3fEXT, PFNGLPROGRAMUNIFORM3FEXTPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3fv, PFNGLPROGRAMUNIFORM3FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3fvEXT, PFNGLPROGRAMUNIFORM3FVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3i, PFNGLPROGRAMUNIFORM3IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3i64ARB, PFNGLPROGRAMUNIFORM3I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z), (program, location, x, y, z), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3i64NV, PFNGLPROGRAMUNIFORM3I64NVPROC, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z), (program, location, x, y, z), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3i64vARB, PFNGLPROGRAMUNIFORM3I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3i64vNV, PFNGLPROGRAMUNIFORM3I64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3iEXT, PFNGLPROGRAMUNIFORM3IEXTPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3iv, PFNGLPROGRAMUNIFORM3IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3ivEXT, PFNGLPROGRAMUNIFORM3IVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3ui, PFNGLPROGRAMUNIFORM3UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3ui64ARB, PFNGLPROGRAMUNIFORM3UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (program, location, x, y, z), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3ui64NV, PFNGLPROGRAMUNIFORM3UI64NVPROC, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (program, location, x, y, z), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3ui64vARB, PFNGLPROGRAMUNIFORM3UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3ui64vNV, PFNGLPROGRAMUNIFORM3UI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3uiEXT, PFNGLPROGRAMUNIFORM3UIEXTPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3uiv, PFNGLPROGRAMUNIFORM3UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform3uivEXT, PFNGLPROGRAMUNIFORM3UIVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4d, PFNGLPROGRAMUNIFORM4DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4dEXT, PFNGLPROGRAMUNIFORM4DEXTPROC, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (program, location, x, y, z, w), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4dv, PFNGLPROGRAMUNIFORM4DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4dvEXT, PFNGLPROGRAMUNIFORM4DVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4f, PFNGLPROGRAMUNIFORM4FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4fEXT, PFNGLPROGRAMUNIFORM4FEXTPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4fv, PFNGLPROGRAMUNIFORM4FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4fvEXT, PFNGLPROGRAMUNIFORM4FVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4i, PFNGLPROGRAMUNIFORM4IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4i64ARB, PFNGLPROGRAMUNIFORM4I64ARBPROC, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (program, location, x, y, z, w), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4i64NV, PFNGLPROGRAMUNIFORM4I64NVPROC, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (program, location, x, y, z, w), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4i64vARB, PFNGLPROGRAMUNIFORM4I64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4i64vNV, PFNGLPROGRAMUNIFORM4I64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4iEXT, PFNGLPROGRAMUNIFORM4IEXTPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4iv, PFNGLPROGRAMUNIFORM4IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4ivEXT, PFNGLPROGRAMUNIFORM4IVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4ui, PFNGLPROGRAMUNIFORM4UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4ui64ARB, PFNGLPROGRAMUNIFORM4UI64ARBPROC, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (program, location, x, y, z, w), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4ui64NV, PFNGLPROGRAMUNIFORM4UI64NVPROC, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (program, location, x, y, z, w), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4ui64vARB, PFNGLPROGRAMUNIFORM4UI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4ui64vNV, PFNGLPROGRAMUNIFORM4UI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4uiEXT, PFNGLPROGRAMUNIFORM4UIEXTPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4uiv, PFNGLPROGRAMUNIFORM4UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniform4uivEXT, PFNGLPROGRAMUNIFORM4UIVEXTPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformHandleui64ARB, PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC, (GLuint program, GLint location, GLuint64 value), (program, location, value), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniformHandleui64NV, PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC, (GLuint program, GLint location, GLuint64 value), (program, location, value), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniformHandleui64vARB, PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformHandleui64vNV, PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2dv, PFNGLPROGRAMUNIFORMMATRIX2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2dvEXT, PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2fv, PFNGLPROGRAMUNIFORMMATRIX2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2fvEXT, PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2x3dv, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2x3dvEXT, PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2x3fv, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2x3fvEXT, PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2x4dv, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2x4dvEXT, PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2x4fv, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix2x4fvEXT, PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3dv, PFNGLPROGRAMUNIFORMMATRIX3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3dvEXT, PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3fv, PFNGLPROGRAMUNIFORMMATRIX3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3fvEXT, PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3x2dv, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3x2dvEXT, PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3x2fv, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3x2fvEXT, PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3x4dv, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3x4dvEXT, PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3x4fv, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix3x4fvEXT, PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4dv, PFNGLPROGRAMUNIFORMMATRIX4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4dvEXT, PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4fv, PFNGLPROGRAMUNIFORMMATRIX4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4fvEXT, PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4x2dv, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4x2dvEXT, PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4x2fv, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4x2fvEXT, PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4x3dv, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4x3dvEXT, PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4x3fv, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformMatrix4x3fvEXT, PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), program, location, count)
+GLAD_PROGRAM_UNIFORM(glProgramUniformui64NV, PFNGLPROGRAMUNIFORMUI64NVPROC, (GLuint program, GLint location, GLuint64EXT value), (program, location, value), program, location, 1)
+GLAD_PROGRAM_UNIFORM(glProgramUniformui64vNV, PFNGLPROGRAMUNIFORMUI64VNVPROC, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), program, location, count)
+GLAD_UNIFORM(glUniform1d, PFNGLUNIFORM1DPROC, (GLint location, GLdouble x), (location, x), location, 1)
+GLAD_UNIFORM(glUniform1dv, PFNGLUNIFORM1DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0), location, 1)
+GLAD_UNIFORM(glUniform1fARB, PFNGLUNIFORM1FARBPROC, (GLint location, GLfloat v0), (location, v0), location, 1)
+GLAD_UNIFORM(glUniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1fvARB, PFNGLUNIFORM1FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0), location, 1)
+GLAD_UNIFORM(glUniform1i64ARB, PFNGLUNIFORM1I64ARBPROC, (GLint location, GLint64 x), (location, x), location, 1)
+GLAD_UNIFORM(glUniform1i64NV, PFNGLUNIFORM1I64NVPROC, (GLint location, GLint64EXT x), (location, x), location, 1)
+GLAD_UNIFORM(glUniform1i64vARB, PFNGLUNIFORM1I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1i64vNV, PFNGLUNIFORM1I64VNVPROC, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1iARB, PFNGLUNIFORM1IARBPROC, (GLint location, GLint v0), (location, v0), location, 1)
+GLAD_UNIFORM(glUniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1ivARB, PFNGLUNIFORM1IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0), location, 1)
+GLAD_UNIFORM(glUniform1ui64ARB, PFNGLUNIFORM1UI64ARBPROC, (GLint location, GLuint64 x), (location, x), location, 1)
+GLAD_UNIFORM(glUniform1ui64NV, PFNGLUNIFORM1UI64NVPROC, (GLint location, GLuint64EXT x), (location, x), location, 1)
+GLAD_UNIFORM(glUniform1ui64vARB, PFNGLUNIFORM1UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1ui64vNV, PFNGLUNIFORM1UI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1uiEXT, PFNGLUNIFORM1UIEXTPROC, (GLint location, GLuint v0), (location, v0), location, 1)
+GLAD_UNIFORM(glUniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform1uivEXT, PFNGLUNIFORM1UIVEXTPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2d, PFNGLUNIFORM2DPROC, (GLint location, GLdouble x, GLdouble y), (location, x, y), location, 1)
+GLAD_UNIFORM(glUniform2dv, PFNGLUNIFORM2DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), location, 1)
+GLAD_UNIFORM(glUniform2fARB, PFNGLUNIFORM2FARBPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), location, 1)
+GLAD_UNIFORM(glUniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2fvARB, PFNGLUNIFORM2FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1), location, 1)
+GLAD_UNIFORM(glUniform2i64ARB, PFNGLUNIFORM2I64ARBPROC, (GLint location, GLint64 x, GLint64 y), (location, x, y), location, 1)
+GLAD_UNIFORM(glUniform2i64NV, PFNGLUNIFORM2I64NVPROC, (GLint location, GLint64EXT x, GLint64EXT y), (location, x, y), location, 1)
+GLAD_UNIFORM(glUniform2i64vARB, PFNGLUNIFORM2I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2i64vNV, PFNGLUNIFORM2I64VNVPROC, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2iARB, PFNGLUNIFORM2IARBPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1), location, 1)
+GLAD_UNIFORM(glUniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2ivARB, PFNGLUNIFORM2IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), location, 1)
+GLAD_UNIFORM(glUniform2ui64ARB, PFNGLUNIFORM2UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y), (location, x, y), location, 1)
+GLAD_UNIFORM(glUniform2ui64NV, PFNGLUNIFORM2UI64NVPROC, (GLint location, GLuint64EXT x, GLuint64EXT y), (location, x, y), location, 1)
+GLAD_UNIFORM(glUniform2ui64vARB, PFNGLUNIFORM2UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2ui64vNV, PFNGLUNIFORM2UI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2uiEXT, PFNGLUNIFORM2UIEXTPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), location, 1)
+GLAD_UNIFORM(glUniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform2uivEXT, PFNGLUNIFORM2UIVEXTPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3d, PFNGLUNIFORM3DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z), location, 1)
+GLAD_UNIFORM(glUniform3dv, PFNGLUNIFORM3DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), location, 1)
+GLAD_UNIFORM(glUniform3fARB, PFNGLUNIFORM3FARBPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), location, 1)
+GLAD_UNIFORM(glUniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3fvARB, PFNGLUNIFORM3FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), location, 1)
+GLAD_UNIFORM(glUniform3i64ARB, PFNGLUNIFORM3I64ARBPROC, (GLint location, GLint64 x, GLint64 y, GLint64 z), (location, x, y, z), location, 1)
+GLAD_UNIFORM(glUniform3i64NV, PFNGLUNIFORM3I64NVPROC, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z), (location, x, y, z), location, 1)
+GLAD_UNIFORM(glUniform3i64vARB, PFNGLUNIFORM3I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3i64vNV, PFNGLUNIFORM3I64VNVPROC, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3iARB, PFNGLUNIFORM3IARBPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), location, 1)
+GLAD_UNIFORM(glUniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3ivARB, PFNGLUNIFORM3IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), location, 1)
+GLAD_UNIFORM(glUniform3ui64ARB, PFNGLUNIFORM3UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (location, x, y, z), location, 1)
+GLAD_UNIFORM(glUniform3ui64NV, PFNGLUNIFORM3UI64NVPROC, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (location, x, y, z), location, 1)
+GLAD_UNIFORM(glUniform3ui64vARB, PFNGLUNIFORM3UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3ui64vNV, PFNGLUNIFORM3UI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3uiEXT, PFNGLUNIFORM3UIEXTPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), location, 1)
+GLAD_UNIFORM(glUniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform3uivEXT, PFNGLUNIFORM3UIVEXTPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4d, PFNGLUNIFORM4DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w), location, 1)
+GLAD_UNIFORM(glUniform4dv, PFNGLUNIFORM4DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), location, 1)
+GLAD_UNIFORM(glUniform4fARB, PFNGLUNIFORM4FARBPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), location, 1)
+GLAD_UNIFORM(glUniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4fvARB, PFNGLUNIFORM4FVARBPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), location, 1)
+GLAD_UNIFORM(glUniform4i64ARB, PFNGLUNIFORM4I64ARBPROC, (GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (location, x, y, z, w), location, 1)
+GLAD_UNIFORM(glUniform4i64NV, PFNGLUNIFORM4I64NVPROC, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (location, x, y, z, w), location, 1)
+GLAD_UNIFORM(glUniform4i64vARB, PFNGLUNIFORM4I64VARBPROC, (GLint location, GLsizei count, const GLint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4i64vNV, PFNGLUNIFORM4I64VNVPROC, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4iARB, PFNGLUNIFORM4IARBPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), location, 1)
+GLAD_UNIFORM(glUniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4ivARB, PFNGLUNIFORM4IVARBPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), location, 1)
+GLAD_UNIFORM(glUniform4ui64ARB, PFNGLUNIFORM4UI64ARBPROC, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (location, x, y, z, w), location, 1)
+GLAD_UNIFORM(glUniform4ui64NV, PFNGLUNIFORM4UI64NVPROC, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (location, x, y, z, w), location, 1)
+GLAD_UNIFORM(glUniform4ui64vARB, PFNGLUNIFORM4UI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4ui64vNV, PFNGLUNIFORM4UI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4uiEXT, PFNGLUNIFORM4UIEXTPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), location, 1)
+GLAD_UNIFORM(glUniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniform4uivEXT, PFNGLUNIFORM4UIVEXTPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), location, count)
+GLAD_PROGRAM_UNIFORM(glUniformBufferEXT, PFNGLUNIFORMBUFFEREXTPROC, (GLuint program, GLint location, GLuint buffer), (program, location, buffer), program, location, 1)
+GLAD_UNIFORM(glUniformHandleui64ARB, PFNGLUNIFORMHANDLEUI64ARBPROC, (GLint location, GLuint64 value), (location, value), location, 1)
+GLAD_UNIFORM(glUniformHandleui64NV, PFNGLUNIFORMHANDLEUI64NVPROC, (GLint location, GLuint64 value), (location, value), location, 1)
+GLAD_UNIFORM(glUniformHandleui64vARB, PFNGLUNIFORMHANDLEUI64VARBPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniformHandleui64vNV, PFNGLUNIFORMHANDLEUI64VNVPROC, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), location, count)
+GLAD_UNIFORM(glUniformMatrix2dv, PFNGLUNIFORMMATRIX2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix2fvARB, PFNGLUNIFORMMATRIX2FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix2x3dv, PFNGLUNIFORMMATRIX2X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix2x4dv, PFNGLUNIFORMMATRIX2X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix3dv, PFNGLUNIFORMMATRIX3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix3fvARB, PFNGLUNIFORMMATRIX3FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix3x2dv, PFNGLUNIFORMMATRIX3X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix3x4dv, PFNGLUNIFORMMATRIX3X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix4dv, PFNGLUNIFORMMATRIX4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix4fvARB, PFNGLUNIFORMMATRIX4FVARBPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix4x2dv, PFNGLUNIFORMMATRIX4X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix4x3dv, PFNGLUNIFORMMATRIX4X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), location, count)
+GLAD_UNIFORM(glUniformui64NV, PFNGLUNIFORMUI64NVPROC, (GLint location, GLuint64EXT value), (location, value), location, 1)
+GLAD_UNIFORM(glUniformui64vNV, PFNGLUNIFORMUI64VNVPROC, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), location, count)
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Generate constexpr block property tables from blocks.json.
+
+    python3 tools/gen_block_tables.py [blocks.json] [BlockTables.h]
+
+For deployments with a fixed block set. The header holds solid and
+transparent bitsets, per-face atlas tiles and hardness, indexed by block
+id, so face culling and collision checks become constant table lookups.
+Ids missing from blocks.json are treated as air (not solid, transparent).
+Runtime loading of blocks.json stays the path for modded block sets.
+
+In blocks.json "tile" sets every face and "top", "bottom", "left",
+"right", "forwards", "backwards" override single faces; a face with
+neither uses tile 0. Without an output path the header is written to stdout.
+"""
+
+import json
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+FACES = ('top', 'bottom', 'left', 'right', 'forwards', 'backwards')
+
+
+def load_blocks(path):
+    with open(path) as f:
+        entries = json.load(f)
+    if not isinstance(entries, list):
+        sys.exit('%s: expected a top-level array of blocks' % path)
+
+    blocks = {}
+    for entry in entries:
+        block_id = entry.get('id')
+        if not isinstance(block_id, int) or block_id < 0:
+            sys.exit('%s: block %r has no valid "id"' % (path, entry.get('name')))
+        if block_id in blocks:
+            sys.exit('%s: duplicate block id %d' % (path, block_id))
+
+        tile = int(entry.get('tile', 0))
+        blocks[block_id] = {
+            'name': str(entry.get('name', '')),
+            'hardness': float(entry.get('hardness', 0.0)),
+            'solid': bool(entry.get('solid', False)),
+            'transparent': bool(entry.get('transparent', False)),
+            'tiles': [int(entry.get(face, tile)) for face in FACES],
+        }
+    if not blocks:
+        sys.exit('%s: no blocks' % path)
+    return blocks
+
+
+def bitset(blocks, count, key, missing):
+    words = [0] * ((count + 63) // 64)
+    for block_id in range(count):
+        block = blocks.get(block_id)
+        if (block[key] if block is not None else missing):
+            words[block_id >> 6] |= 1 << (block_id & 63)
+    return ', '.join('0x%016xull' % word for word in words)
+
+
+def c_string(text):
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def c_float(value):
+    text = repr(float(value))
+    return (text if ('.' in text or 'e' in text) else text + '.0') + 'f'
+
+
+def generate(blocks, source_name):
+    count = max(blocks) + 1
+    air = {'name': '', 'hardness': 0.0, 'solid': False, 'transparent': True, 'tiles': [0] * len(FACES)}
+    rows = [blocks.get(block_id, air) for block_id in range(count)]
+
+    out = [
+        '// Generated by tools/gen_block_tables.py from %s; do not edit.' % source_name,
+        '#pragma once',
+        '',
+        '#include <cstdint>',
+        '',
+        'namespace block_tables',
+        '{',
+        '    constexpr int kBlockCount = %d;' % count,
+        '',
+        '    // Face order matches the blocks.json keys.',
+        '    enum Face { Top, Bottom, Left, Right, Forwards, Backwards, FaceCount };',
+        '',
+        '    constexpr std::uint64_t kSolid[] = { %s };' % bitset(blocks, count, 'solid', False),
+        '    constexpr std::uint64_t kTransparent[] = { %s };' % bitset(blocks, count, 'transparent', True),
+        '',
+        '    constexpr std::uint16_t kFaceTiles[kBlockCount][FaceCount] = {',
+    ]
+    for block_id, row in enumerate(rows):
+        out.append('        { %s }, // %d %s' % (', '.join(str(t) for t in row['tiles']), block_id, row['name']))
+    out += [
+        '    };',
+        '',
+        '    constexpr float kHardness[kBlockCount] = { %s };' % ', '.join(c_float(row['hardness']) for row in rows),
+        '',
+        '    constexpr const char* kNames[kBlockCount] = { %s };' % ', '.join(c_string(row['name']) for row in rows),
+        '',
+        '    constexpr bool IsValid(int id) { return id >= 0 && id < kBlockCount; }',
+        '',
+        '    constexpr bool IsSolid(int id)',
+        '    {',
+        '        return IsValid(id) && ((kSolid[id >> 6] >> (id & 63)) & 1u) != 0;',
+        '    }',
+        '',
+        '    // Unknown ids are treated as air.',
+        '    constexpr bool IsTransparent(int id)',
+        '    {',
+        '        return !IsValid(id) || ((kTransparent[id >> 6] >> (id & 63)) & 1u) != 0;',
+        '    }',
+        '',
+        '    constexpr int FaceTile(int id, Face face) { return IsValid(id) ? kFaceTiles[id][face] : 0; }',
+        '',
+        '    constexpr float Hardness(int id) { return IsValid(id) ? kHardness[id] : 0.0f; }',
+        '}',
+    ]
+    return '\n'.join(out) + '\n'
+
+
+def main(argv):
+    source = argv[1] if len(argv) > 1 else os.path.join(ROOT, 'blocks.json')
+    header = generate(load_blocks(source), os.path.basename(source))
+    if len(argv) > 2:
+        with open(argv[2], 'w', newline='\n') as f:
+            f.write(header)
+    else:
+        sys.stdout.write(header)
+
+
+if __name__ == '__main__':
+    main(sys.argv)
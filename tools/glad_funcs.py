@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Generate the X-macro lists of GL entry points used by the glad companions.
+
+The lists are read from the typedefs and pointer declarations in
+include/glad/glad.h, so they have to be regenerated whenever glad is.
+
+    python3 tools/glad_funcs.py [include/glad/glad.h] [src]
+
+src/glad_funcs.h lists every entry point, each one as
+
+    GLAD_FUNC(ret, name, pfn, params, args)
+    GLAD_FUNC_VOID(name, pfn, params, args)
+
+src/glad_uniform_funcs.h lists the entry points that write uniform
+values, glUniform* taking a location first and glProgramUniform* taking
+a program and a location first, as
+
+    GLAD_UNIFORM(name, pfn, params, args, location, count)
+    GLAD_PROGRAM_UNIFORM(name, pfn, params, args, program, location, count)
+
+where location, program and count name the parameters, and count is 1
+for the forms that set a single value.
+
+Entries are sorted by name in strcmp() order, so consumers can binary
+search tables built from the lists.
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+TYPEDEF_RE = re.compile(
+    r'^typedef (?P<ret>[A-Za-z0-9_ *]+?) ?\(APIENTRYP (?P<pfn>PFN[A-Z0-9_]+PROC)\)\((?P<params>.*)\);$')
+POINTER_RE = re.compile(r'^GLAPI (?P<pfn>PFN[A-Z0-9_]+PROC) glad_(?P<name>gl[A-Za-z0-9_]+);$')
+PARAM_NAME_RE = re.compile(r'([A-Za-z_][A-Za-z0-9_]*)\s*$')
+
+
+def parse(header):
+    typedefs = {}
+    funcs = []
+    with open(header) as f:
+        for line in f:
+            line = line.rstrip('\n')
+            m = TYPEDEF_RE.match(line)
+            if m:
+                typedefs[m.group('pfn')] = (m.group('ret').strip(), m.group('params').strip())
+                continue
+            m = POINTER_RE.match(line)
+            if m:
+                ret, params = typedefs[m.group('pfn')]
+                funcs.append((m.group('name'), m.group('pfn'), ret, params))
+    return sorted(funcs)
+
+
+def call_args(params):
+    if params == 'void':
+        return '()'
+    names = []
+    for param in params.split(','):
+        m = PARAM_NAME_RE.search(param)
+        if m is None:
+            raise ValueError('cannot find parameter name in %r' % params)
+        names.append(m.group(1))
+    return '(' + ', '.join(names) + ')'
+
+
+def param_names(params):
+    if params == 'void':
+        return []
+    return call_args(params)[1:-1].split(', ')
+
+
+def write_list(path, title, macros, entries):
+    lines = ['/*', ''] + ['    ' + line for line in title] + [
+        '    Generated by tools/glad_funcs.py; do not edit by hand.',
+        '',
+    ] + ['    ' + line for line in macros] + [
+        '',
+        '    Entries are sorted by name in strcmp() order.',
+        '',
+        '*/',
+        '',
+    ] + entries
+    with open(path, 'w', newline='\n') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main(argv):
+    header = argv[1] if len(argv) > 1 else os.path.join(ROOT, 'include', 'glad', 'glad.h')
+    outdir = argv[2] if len(argv) > 2 else os.path.join(ROOT, 'src')
+
+    funcs = []
+    uniforms = []
+    for name, pfn, ret, params in parse(header):
+        args = call_args(params)
+        if ret == 'void':
+            funcs.append('GLAD_FUNC_VOID(%s, %s, (%s), %s)' % (name, pfn, params, args))
+        else:
+            funcs.append('GLAD_FUNC(%s, %s, %s, (%s), %s)' % (ret, name, pfn, params, args))
+
+        if not (name.startswith('glUniform') or name.startswith('glProgramUniform')):
+            continue
+        names = param_names(params)
+        count = 'count' if 'count' in names else '1'
+        if ret != 'void':
+            raise ValueError('uniform entry point %s does not return void' % name)
+        if names[:1] == ['location']:
+            uniforms.append('GLAD_UNIFORM(%s, %s, (%s), %s, location, %s)' % (name, pfn, params, args, count))
+        elif names[:2] == ['program', 'location']:
+            uniforms.append('GLAD_PROGRAM_UNIFORM(%s, %s, (%s), %s, program, location, %s)'
+                            % (name, pfn, params, args, count))
+
+    write_list(os.path.join(outdir, 'glad_funcs.h'), [
+        'X-macro list of every GL entry point declared in glad/glad.h.',
+    ], [
+        'GLAD_FUNC(ret, name, pfn, params, args)',
+        'GLAD_FUNC_VOID(name, pfn, params, args)',
+    ], funcs)
+    write_list(os.path.join(outdir, 'glad_uniform_funcs.h'), [
+        'X-macro list of every entry point in glad/glad.h that writes uniforms.',
+    ], [
+        'GLAD_UNIFORM(name, pfn, params, args, location, count)',
+        'GLAD_PROGRAM_UNIFORM(name, pfn, params, args, program, location, count)',
+    ], uniforms)
+
+
+if __name__ == '__main__':
+    main(sys.argv)
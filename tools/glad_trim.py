@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Build a usage-trimmed copy of the glad loader.
+
+    python3 tools/glad_trim.py scan <path>... > gl_usage.txt
+    python3 tools/glad_trim.py generate gl_usage.txt <outdir>
+
+`scan` walks the given client sources and prints every GL function and
+extension they reference (glFoo, glad_glFoo, GLAD_GL_FOO_bar, GL_FOO_bar),
+one name per line. Files named glad* are skipped, since the loader and its
+companions reference everything.
+
+`generate` reads such a list ('#' starts a comment) and writes a trimmed
+src/glad.c and src/glad_funcs.h to <outdir>, along with an unchanged copy
+of src/glad_lazy.c. Build against <outdir> instead of src/ with the regular
+include/ directory. The trimmed loader only looks up the listed functions,
+and only detects the listed extensions plus any extension that loads a
+listed function. Core version flags are always kept.
+
+The development layers (glad_mock.c and friends) refer to specific entry
+points and only build against the full loader.
+
+The header is left untouched. A reference to a pointer or extension flag
+that was trimmed away is an undefined glad_gl* / GLAD_GL_* symbol at link
+time, so a stale list cannot silently produce a NULL function pointer.
+"""
+
+import os
+import re
+import shutil
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, 'src')
+
+SOURCE_EXTS = ('.c', '.cc', '.cpp', '.cxx', '.h', '.hh', '.hpp', '.hxx', '.inl')
+
+# Entry points gladLoadGLLoader() itself calls to detect the context.
+LOADER_FUNCS = ('glGetString', 'glGetIntegerv', 'glGetStringi')
+
+# Companion sources that only go through glad_funcs.h and so build against
+# the trimmed list.
+TRIMMED_COMPANIONS = ('glad_lazy.c',)
+
+POINTER_DEF_RE = re.compile(r'^PFN[A-Z0-9_]+PROC glad_(gl\w+) = NULL;$')
+FLAG_DEF_RE = re.compile(r'^int GLAD_(GL_\w+) = 0;$')
+LOAD_BEGIN_RE = re.compile(r'^static void load_(GL_\w+)\(GLADloadproc load\) \{$')
+LOAD_LINE_RE = re.compile(r'^\tglad_(gl\w+) = \(PFN[A-Z0-9_]+PROC\)load\("gl\w+"\);$')
+LOAD_CALL_RE = re.compile(r'^\tload_(GL_\w+)\(load\);$')
+HAS_EXT_RE = re.compile(r'^\tGLAD_(GL_\w+) = has_ext\("GL_\w+"\);$')
+FUNC_ENTRY_RE = re.compile(r'^GLAD_FUNC(?:_VOID)?\((?:[^,]+, )?(gl\w+), ')
+COMMENT_EXT_RE = re.compile(r'^        (GL_\w+),?$')
+
+TOKEN_RE = re.compile(r'\b(?:glad_|GLAD_)?(gl[A-Z]\w*|GL_\w+)\b')
+
+
+def is_version(name):
+    return name.startswith('GL_VERSION_')
+
+
+def read_lines(path):
+    with open(path) as f:
+        return f.read().split('\n')
+
+
+def known_names():
+    functions = set()
+    extensions = set()
+    for line in read_lines(os.path.join(SRC, 'glad.c')):
+        m = POINTER_DEF_RE.match(line)
+        if m:
+            functions.add(m.group(1))
+            continue
+        m = FLAG_DEF_RE.match(line)
+        if m and not is_version(m.group(1)):
+            extensions.add(m.group(1))
+    return functions, extensions
+
+
+def iter_sources(paths):
+    for path in paths:
+        if os.path.isfile(path):
+            yield path
+            continue
+        for dirpath, dirnames, filenames in os.walk(path):
+            dirnames[:] = sorted(d for d in dirnames if not d.startswith('.'))
+            for filename in sorted(filenames):
+                if filename.endswith(SOURCE_EXTS):
+                    yield os.path.join(dirpath, filename)
+
+
+def scan(paths):
+    functions, extensions = known_names()
+    used = set()
+    for path in iter_sources(paths):
+        if os.path.basename(path).startswith('glad'):
+            continue
+        with open(path, errors='replace') as f:
+            for m in TOKEN_RE.finditer(f.read()):
+                name = m.group(1)
+                if name in functions or name in extensions:
+                    used.add(name)
+
+    print('# GL usage extracted by tools/glad_trim.py scan')
+    for name in sorted(used, key=lambda n: (n.startswith('GL_'), n)):
+        print(name)
+
+
+def read_usage(path):
+    names = set()
+    for line in read_lines(path):
+        line = line.split('#', 1)[0].strip()
+        if line:
+            names.add(line)
+    return names
+
+
+def generate(usage_path, outdir):
+    functions, extensions = known_names()
+    usage = read_usage(usage_path)
+    unknown = sorted(usage - functions - extensions)
+    if unknown:
+        sys.exit('unknown GL names in %s: %s' % (usage_path, ', '.join(unknown)))
+
+    keep_funcs = (usage & functions) | set(LOADER_FUNCS)
+    keep_exts = usage & extensions
+
+    lines = read_lines(os.path.join(SRC, 'glad.c'))
+
+    # Keep every extension whose load function pulls in a kept pointer, or
+    # the pointer would never be loaded on contexts that only expose it
+    # through that extension.
+    current = None
+    for line in lines:
+        m = LOAD_BEGIN_RE.match(line)
+        if m:
+            current = m.group(1)
+            continue
+        if line == '}':
+            current = None
+            continue
+        m = LOAD_LINE_RE.match(line)
+        if m and current is not None and not is_version(current) and m.group(1) in keep_funcs:
+            keep_exts.add(current)
+
+    def keep_block(name):
+        return is_version(name) or name in keep_exts
+
+    out = []
+    current = None
+    loads = 0
+    in_ext_comment = False
+    for line in lines:
+        if line == '    Extensions:':
+            in_ext_comment = True
+            out.append(line)
+            continue
+        if in_ext_comment:
+            m = COMMENT_EXT_RE.match(line)
+            if m:
+                continue
+            in_ext_comment = False
+            for index, name in enumerate(sorted(keep_exts)):
+                out.append('        %s%s' % (name, ',' if index + 1 < len(keep_exts) else ''))
+            out.append('    Trimmed by tools/glad_trim.py to %d functions and %d extensions.'
+                       % (len(keep_funcs), len(keep_exts)))
+
+        m = POINTER_DEF_RE.match(line)
+        if m:
+            if m.group(1) in keep_funcs:
+                out.append(line)
+            continue
+        m = FLAG_DEF_RE.match(line)
+        if m:
+            if keep_block(m.group(1)):
+                out.append(line)
+            continue
+        m = HAS_EXT_RE.match(line)
+        if m:
+            if m.group(1) in keep_exts:
+                out.append(line)
+            continue
+        m = LOAD_CALL_RE.match(line)
+        if m:
+            if keep_block(m.group(1)):
+                out.append(line)
+            continue
+        m = LOAD_BEGIN_RE.match(line)
+        if m:
+            current = m.group(1)
+            loads = 0
+            if keep_block(current):
+                out.append(line)
+            continue
+        if current is not None:
+            if line == '}':
+                if keep_block(current):
+                    # A loader left with no lookups still has to use its
+                    # parameter to build warning-free.
+                    if loads == 0:
+                        out.append('\t(void)load;')
+                    out.append(line)
+                current = None
+                continue
+            if not keep_block(current):
+                continue
+            m = LOAD_LINE_RE.match(line)
+            if m:
+                if m.group(1) not in keep_funcs:
+                    continue
+                loads += 1
+        out.append(line)
+
+    outsrc = os.path.join(outdir, 'src')
+    os.makedirs(outsrc, exist_ok=True)
+    with open(os.path.join(outsrc, 'glad.c'), 'w', newline='\n') as f:
+        f.write('\n'.join(out))
+
+    funcs_out = [line for line in read_lines(os.path.join(SRC, 'glad_funcs.h'))
+                 if not FUNC_ENTRY_RE.match(line) or FUNC_ENTRY_RE.match(line).group(1) in keep_funcs]
+    with open(os.path.join(outsrc, 'glad_funcs.h'), 'w', newline='\n') as f:
+        f.write('\n'.join(funcs_out))
+
+    for filename in TRIMMED_COMPANIONS:
+        shutil.copyfile(os.path.join(SRC, filename), os.path.join(outsrc, filename))
+
+    sys.stderr.write('glad_trim: kept %d of %d functions, %d of %d extensions\n'
+                     % (len(keep_funcs), len(functions), len(keep_exts), len(extensions)))
+
+
+def main(argv):
+    if len(argv) >= 3 and argv[1] == 'scan':
+        scan(argv[2:])
+    elif len(argv) == 4 and argv[1] == 'generate':
+        generate(argv[2], argv[3])
+    else:
+        sys.exit(__doc__)
+
+
+if __name__ == '__main__':
+    main(sys.argv)